@@ -0,0 +1,508 @@
+// ============================== ATOMIC PACK =============================== //
+// Project:         Pack
+// Name:            atomic_pack.hpp
+// Description:     Small trivially copyable packs updated as a single word
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _ATOMIC_PACK_HPP_INCLUDED
+#define _ATOMIC_PACK_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <functional>
+#include <type_traits>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "object_pack.hpp"
+// Third-party libraries
+// Miscellaneous
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && defined(__SIZEOF_INT128__)
+#define PCK_HAS_CMPXCHG16B 1
+#endif
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ****************************** ATOMIC PACK ******************************* */
+// Atomic pack class definition: the elements copied side by side in one word
+// Packs of 9 to 16 bytes use cmpxchg16b when it is enabled, with -mcx16 on
+// x86-64, and otherwise go through std::atomic, which may need libatomic
+template <class... Types>
+class atomic_pack
+{
+    // Types
+    public:
+    using value_type = object_pack<Types...>;
+    using size_type = std::size_t;
+
+    // Lifecycle
+    public:
+    atomic_pack() noexcept;
+    explicit atomic_pack(const value_type&) noexcept;
+    atomic_pack(const atomic_pack&) = delete;
+    atomic_pack& operator=(const atomic_pack&) = delete;
+
+    // Operations
+    public:
+    value_type load(
+        std::memory_order = std::memory_order_seq_cst
+    ) const noexcept;
+    void store(
+        const value_type&,
+        std::memory_order = std::memory_order_seq_cst
+    ) noexcept;
+    value_type exchange(
+        const value_type&,
+        std::memory_order = std::memory_order_seq_cst
+    ) noexcept;
+    bool compare_exchange_weak(
+        value_type&,
+        const value_type&,
+        std::memory_order = std::memory_order_seq_cst
+    ) noexcept;
+    bool compare_exchange_strong(
+        value_type&,
+        const value_type&,
+        std::memory_order = std::memory_order_seq_cst
+    ) noexcept;
+    template <class Function>
+    value_type update(
+        Function&&,
+        std::memory_order = std::memory_order_seq_cst
+    );
+
+    // Lock freedom
+    public:
+    static constexpr bool is_always_lock_free() noexcept;
+    bool is_lock_free() const noexcept;
+
+    // Size
+    public:
+    static constexpr size_type size() noexcept;
+
+    // Implementation details: layout
+    private:
+    static_assert(
+        pack_conjunction_v<std::is_trivially_copyable_v<Types>...>,
+        "the types should be trivially copyable"
+    );
+    static_assert(
+        pack_conjunction_v<std::is_default_constructible_v<Types>...>,
+        "the types should be default constructible"
+    );
+    static constexpr size_type _size = (sizeof(Types) + ... + size_type(0));
+    static_assert(_size <= 16, "the types should fit in 128 bits");
+    static constexpr size_type _offset(size_type) noexcept;
+
+    // Implementation details: words
+    private:
+#if defined(PCK_HAS_CMPXCHG16B)
+    __extension__ using _wide_type = unsigned __int128;
+    static constexpr bool _is_native_wide = _size > 8;
+#else
+    struct alignas(16) _wide_type {
+        std::uint64_t words[2];
+    };
+    static constexpr bool _is_native_wide = false;
+#endif
+    using _word_type = std::conditional_t<
+        (_size <= 1),
+        std::uint8_t,
+        std::conditional_t<
+            (_size <= 2),
+            std::uint16_t,
+            std::conditional_t<
+                (_size <= 4),
+                std::uint32_t,
+                std::conditional_t<(_size <= 8), std::uint64_t, _wide_type>
+            >
+        >
+    >;
+    using _storage_type = std::conditional_t<
+        _is_native_wide,
+        _word_type,
+        std::atomic<_word_type>
+    >;
+    static _word_type _encode(const value_type&) noexcept;
+    template <std::size_t... Indices>
+    static _word_type _encode(
+        const value_type&,
+        pack_index_sequence<Indices...>
+    ) noexcept;
+    static value_type _decode(const _word_type&) noexcept;
+    template <std::size_t... Indices>
+    static value_type _decode(
+        const _word_type&,
+        pack_index_sequence<Indices...>
+    ) noexcept;
+
+    // Implementation details: word operations
+    private:
+    static constexpr std::memory_order _failure(std::memory_order) noexcept;
+    _word_type _load(std::memory_order) const noexcept;
+    void _store(_word_type, std::memory_order) noexcept;
+    _word_type _exchange(_word_type, std::memory_order) noexcept;
+    bool _compare_exchange(
+        _word_type&,
+        _word_type,
+        std::memory_order,
+        std::memory_order,
+        bool
+    ) noexcept;
+
+    // Implementation details: data members, mutable since cmpxchg16b writes
+    private:
+    mutable _storage_type _word;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- ATOMIC PACK: LIFECYCLE ------------------------- //
+// Constructs an atomic pack of value-initialized elements
+template <class... Types>
+atomic_pack<Types...>::atomic_pack(
+) noexcept
+: _word(_encode(value_type()))
+{
+}
+
+// Explicitly constructs an atomic pack from a pack of values
+template <class... Types>
+atomic_pack<Types...>::atomic_pack(
+    const value_type& value
+) noexcept
+: _word(_encode(value))
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ ATOMIC PACK: OPERATIONS ------------------------- //
+// Atomically loads all the elements
+template <class... Types>
+typename atomic_pack<Types...>::value_type atomic_pack<Types...>::load(
+    std::memory_order order
+) const noexcept
+{
+    return _decode(_load(order));
+}
+
+// Atomically stores all the elements
+template <class... Types>
+void atomic_pack<Types...>::store(
+    const value_type& value,
+    std::memory_order order
+) noexcept
+{
+    _store(_encode(value), order);
+}
+
+// Atomically replaces all the elements and returns the previous ones
+template <class... Types>
+typename atomic_pack<Types...>::value_type atomic_pack<Types...>::exchange(
+    const value_type& value,
+    std::memory_order order
+) noexcept
+{
+    return _decode(_exchange(_encode(value), order));
+}
+
+// Replaces the elements if they are bitwise equal to the expected ones,
+// and otherwise loads them into the expected ones, failing spuriously
+template <class... Types>
+bool atomic_pack<Types...>::compare_exchange_weak(
+    value_type& expected,
+    const value_type& desired,
+    std::memory_order order
+) noexcept
+{
+    _word_type word = _encode(expected);
+    const bool exchanged = _compare_exchange(
+        word,
+        _encode(desired),
+        order,
+        _failure(order),
+        true
+    );
+    if (!exchanged) {
+        expected = _decode(word);
+    }
+    return exchanged;
+}
+
+// Replaces the elements if they are bitwise equal to the expected ones,
+// and otherwise loads them into the expected ones
+template <class... Types>
+bool atomic_pack<Types...>::compare_exchange_strong(
+    value_type& expected,
+    const value_type& desired,
+    std::memory_order order
+) noexcept
+{
+    _word_type word = _encode(expected);
+    const bool exchanged = _compare_exchange(
+        word,
+        _encode(desired),
+        order,
+        _failure(order),
+        false
+    );
+    if (!exchanged) {
+        expected = _decode(word);
+    }
+    return exchanged;
+}
+
+// Applies a function to a copy of the elements until the copy is stored
+// without interference, and returns it: the function may be called again
+template <class... Types>
+template <class Function>
+typename atomic_pack<Types...>::value_type atomic_pack<Types...>::update(
+    Function&& function,
+    std::memory_order order
+)
+{
+    _word_type word = _load(std::memory_order_relaxed);
+    while (true) {
+        value_type value = _decode(word);
+        std::invoke(function, value);
+        if (_compare_exchange(
+            word,
+            _encode(value),
+            order,
+            std::memory_order_relaxed,
+            true
+        )) {
+            return value;
+        }
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- ATOMIC PACK: LOCK FREEDOM ------------------------ //
+// Checks whether the operations never use a lock, whatever the processor
+template <class... Types>
+constexpr bool atomic_pack<Types...>::is_always_lock_free(
+) noexcept
+{
+    if constexpr (_is_native_wide) {
+        return true;
+    } else {
+        return std::atomic<_word_type>::is_always_lock_free;
+    }
+}
+
+// Checks whether the operations never use a lock on this processor
+template <class... Types>
+bool atomic_pack<Types...>::is_lock_free(
+) const noexcept
+{
+    if constexpr (_is_native_wide) {
+        return true;
+    } else {
+        return _word.is_lock_free();
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- ATOMIC PACK: SIZE ---------------------------- //
+// Returns the number of elements in the pack
+template <class... Types>
+constexpr typename atomic_pack<Types...>::size_type
+atomic_pack<Types...>::size(
+) noexcept
+{
+    return sizeof...(Types);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------ ATOMIC PACK: IMPLEMENTATION DETAILS ------------------- //
+// Returns the offset of an element in the word
+template <class... Types>
+constexpr typename atomic_pack<Types...>::size_type
+atomic_pack<Types...>::_offset(
+    size_type index
+) noexcept
+{
+    constexpr size_type sizes[] = {sizeof(Types)..., size_type(0)};
+    size_type offset = 0;
+    for (size_type i = 0; i < index; ++i) {
+        offset += sizes[i];
+    }
+    return offset;
+}
+
+// Copies the elements into a word
+template <class... Types>
+typename atomic_pack<Types...>::_word_type atomic_pack<Types...>::_encode(
+    const value_type& value
+) noexcept
+{
+    return _encode(value, make_pack_index_sequence<sizeof...(Types)>{});
+}
+
+// Copies the elements into a word whose unused bytes are zeroed, so that
+// equal elements give equal words
+template <class... Types>
+template <std::size_t... Indices>
+typename atomic_pack<Types...>::_word_type atomic_pack<Types...>::_encode(
+    const value_type& value,
+    pack_index_sequence<Indices...>
+) noexcept
+{
+    _word_type word = {};
+    unsigned char* bytes = reinterpret_cast<unsigned char*>(&word);
+    (std::memcpy(
+        bytes + _offset(Indices),
+        std::addressof(get<Indices>(value)),
+        sizeof(Types)
+    ), ...);
+    return word;
+}
+
+// Copies the elements out of a word
+template <class... Types>
+typename atomic_pack<Types...>::value_type atomic_pack<Types...>::_decode(
+    const _word_type& word
+) noexcept
+{
+    return _decode(word, make_pack_index_sequence<sizeof...(Types)>{});
+}
+
+// Copies the elements out of a word into a pack
+template <class... Types>
+template <std::size_t... Indices>
+typename atomic_pack<Types...>::value_type atomic_pack<Types...>::_decode(
+    const _word_type& word,
+    pack_index_sequence<Indices...>
+) noexcept
+{
+    value_type value(uninitialized);
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&word);
+    (std::memcpy(
+        std::addressof(get<Indices>(value)),
+        bytes + _offset(Indices),
+        sizeof(Types)
+    ), ...);
+    return value;
+}
+
+// Returns the ordering of a failed compare exchange given the requested one
+template <class... Types>
+constexpr std::memory_order atomic_pack<Types...>::_failure(
+    std::memory_order order
+) noexcept
+{
+    if (order == std::memory_order_acq_rel) {
+        return std::memory_order_acquire;
+    } else if (order == std::memory_order_release) {
+        return std::memory_order_relaxed;
+    } else {
+        return order;
+    }
+}
+
+// Loads the word: cmpxchg16b exchanges it with itself, a full barrier
+template <class... Types>
+typename atomic_pack<Types...>::_word_type atomic_pack<Types...>::_load(
+    std::memory_order order
+) const noexcept
+{
+    if constexpr (_is_native_wide) {
+        return __sync_val_compare_and_swap(&_word, _word_type(), _word_type());
+    } else {
+        return _word.load(order);
+    }
+}
+
+// Stores the word
+template <class... Types>
+void atomic_pack<Types...>::_store(
+    _word_type word,
+    std::memory_order order
+) noexcept
+{
+    if constexpr (_is_native_wide) {
+        _exchange(word, order);
+    } else {
+        _word.store(word, order);
+    }
+}
+
+// Replaces the word and returns the previous one
+template <class... Types>
+typename atomic_pack<Types...>::_word_type atomic_pack<Types...>::_exchange(
+    _word_type word,
+    std::memory_order order
+) noexcept
+{
+    if constexpr (_is_native_wide) {
+        _word_type expected = _load(std::memory_order_relaxed);
+        while (!_compare_exchange(expected, word, order, order, true)) {
+        }
+        return expected;
+    } else {
+        return _word.exchange(word, order);
+    }
+}
+
+// Replaces the word if it equals the expected one, which is otherwise
+// overwritten by the current word
+template <class... Types>
+bool atomic_pack<Types...>::_compare_exchange(
+    _word_type& expected,
+    _word_type desired,
+    std::memory_order success,
+    std::memory_order failure,
+    bool weak
+) noexcept
+{
+    if constexpr (_is_native_wide) {
+        const _word_type word = __sync_val_compare_and_swap(
+            &_word,
+            expected,
+            desired
+        );
+        const bool exchanged = word == expected;
+        expected = word;
+        return exchanged;
+    } else if (weak) {
+        return _word.compare_exchange_weak(expected, desired, success, failure);
+    } else {
+        return _word.compare_exchange_strong(
+            expected,
+            desired,
+            success,
+            failure
+        );
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _ATOMIC_PACK_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,594 @@
+// ============================= BITFIELD PACK ============================== //
+// Project:         Pack
+// Name:            bitfield_pack.hpp
+// Description:     Small unsigned fields packed side by side in words
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BITFIELD_PACK_HPP_INCLUDED
+#define _BITFIELD_PACK_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "nontype_pack.hpp"
+#include "object_pack.hpp"
+// Third-party libraries
+// Miscellaneous
+#if defined(__BMI2__) && defined(__x86_64__)
+#define PCK_HAS_BMI2 1
+#include <immintrin.h>
+#endif
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ***************************** BITFIELD VALUE ***************************** */
+// Bitfield value structure definition: the smallest unsigned integer type
+// holding a field of the given number of bits
+template <std::size_t Width>
+struct bitfield_value
+{
+    static_assert(Width > 0 && Width <= 64, "the width should be in [1, 64]");
+    using type = std::conditional_t<
+        (Width <= 8),
+        std::uint8_t,
+        std::conditional_t<
+            (Width <= 16),
+            std::uint16_t,
+            std::conditional_t<(Width <= 32), std::uint32_t, std::uint64_t>
+        >
+    >;
+};
+
+// Bitfield value type alias
+template <std::size_t Width>
+using bitfield_value_t = typename bitfield_value<Width>::type;
+
+// Returns the mask of the given number of low bits
+inline constexpr std::uint64_t bitfield_mask(
+    std::size_t width
+) noexcept
+{
+    return width < 64 ? (std::uint64_t(1) << width) - 1 : ~std::uint64_t(0);
+}
+/* ************************************************************************** */
+
+
+
+/* ***************************** BITFIELD PACK ****************************** */
+// Bitfield pack class declaration
+template <class Widths>
+class bitfield_pack;
+
+// Bitfield pack class definition: the fields follow each other from the low
+// bits of the first word, in the smallest word that holds all of them, or
+// in as few 64-bit words as possible, a field then crossing two words
+template <auto... Widths>
+class bitfield_pack<nontype_pack<Widths...>>
+{
+    // Types and constants
+    public:
+    using size_type = std::size_t;
+    template <std::size_t Index>
+    using field_type = std::tuple_element_t<
+        Index,
+        std::tuple<bitfield_value_t<Widths>...>
+    >;
+    using value_type = object_pack<bitfield_value_t<Widths>...>;
+    static constexpr size_type bits = (size_type(0) + ... + Widths);
+    using word_type = bitfield_value_t<(
+        bits == 0 ? 1 : bits <= 32 ? bits : 64
+    )>;
+    static constexpr size_type words = (
+        bits + sizeof(word_type) * 8 - 1
+    ) / (sizeof(word_type) * 8);
+
+    // Lifecycle
+    public:
+    constexpr bitfield_pack() noexcept;
+    explicit bitfield_pack(const value_type&) noexcept;
+
+    // Access
+    public:
+    template <std::size_t Index>
+    constexpr field_type<Index> get() const noexcept;
+    template <std::size_t Index>
+    constexpr void set(field_type<Index>) noexcept;
+
+    // Bulk access
+    public:
+    value_type unpack() const noexcept;
+    void pack(const value_type&) noexcept;
+
+    // Size
+    public:
+    static constexpr size_type size() noexcept;
+
+    // Implementation details: layout
+    private:
+    static constexpr size_type _count = sizeof...(Widths);
+    static constexpr size_type _word_bits = sizeof(word_type) * 8;
+    static constexpr std::array<size_type, _count> _widths = {Widths...};
+    static constexpr std::array<size_type, _count> _offsets = [] {
+        std::array<size_type, _count> offsets = {};
+        size_type offset = 0;
+        size_type index = 0;
+        ((offsets[index++] = offset, offset += Widths), ...);
+        return offsets;
+    }();
+
+    // Implementation details: lanes, the fields spread to their own types
+    private:
+    static constexpr std::array<size_type, _count> _lanes = [] {
+        std::array<size_type, _count> lanes = {};
+        size_type lane = 0;
+        size_type index = 0;
+        ((
+            lane = (lane + sizeof(bitfield_value_t<Widths>) * 8 - 1)
+            / (sizeof(bitfield_value_t<Widths>) * 8)
+            * (sizeof(bitfield_value_t<Widths>) * 8),
+            lanes[index++] = lane,
+            lane += sizeof(bitfield_value_t<Widths>) * 8
+        ), ...);
+        return lanes;
+    }();
+    static constexpr bool _spreadable = words == 1 && (
+        _count == 0 || _lanes[_count - 1] + _widths[_count - 1] <= 64
+    );
+    template <std::size_t... Indices>
+    static constexpr std::uint64_t _lane_mask(
+        pack_index_sequence<Indices...>
+    ) noexcept;
+    template <std::size_t... Indices>
+    value_type _unpack(pack_index_sequence<Indices...>) const noexcept;
+    template <std::size_t... Indices>
+    void _pack(const value_type&, pack_index_sequence<Indices...>) noexcept;
+
+    // Implementation details: data members
+    private:
+    std::array<word_type, words> _words;
+};
+/* ************************************************************************** */
+
+
+
+/* **************************** BITFIELD VECTOR ***************************** */
+// Bitfield vector class declaration
+template <class Widths>
+class bitfield_vector;
+
+// Bitfield vector class definition: a structure of arrays, each field being
+// stored in its own column of 64-bit words, with no padding between rows
+template <auto... Widths>
+class bitfield_vector<nontype_pack<Widths...>>
+{
+    // Types
+    public:
+    using size_type = std::size_t;
+    template <std::size_t Index>
+    using field_type = std::tuple_element_t<
+        Index,
+        std::tuple<bitfield_value_t<Widths>...>
+    >;
+    using value_type = object_pack<bitfield_value_t<Widths>...>;
+
+    // Lifecycle
+    public:
+    bitfield_vector() = default;
+    explicit bitfield_vector(size_type);
+
+    // Access
+    public:
+    template <std::size_t Index>
+    field_type<Index> get(size_type) const noexcept;
+    template <std::size_t Index>
+    void set(size_type, field_type<Index>) noexcept;
+    value_type load(size_type) const noexcept;
+    void store(size_type, const value_type&) noexcept;
+
+    // Modifiers
+    public:
+    void push_back(const value_type&);
+    void resize(size_type);
+    void reserve(size_type);
+    void clear() noexcept;
+
+    // Capacity
+    public:
+    size_type size() const noexcept;
+    bool empty() const noexcept;
+
+    // Implementation details: columns
+    private:
+    static constexpr size_type _count = sizeof...(Widths);
+    static constexpr std::array<size_type, _count> _widths = {Widths...};
+    static constexpr size_type _words(size_type, size_type) noexcept;
+    template <std::size_t... Indices>
+    value_type _load(size_type, pack_index_sequence<Indices...>) const noexcept;
+    template <std::size_t... Indices>
+    void _store(
+        size_type,
+        const value_type&,
+        pack_index_sequence<Indices...>
+    ) noexcept;
+
+    // Implementation details: data members
+    private:
+    std::array<std::vector<std::uint64_t>, _count> _columns;
+    size_type _size = 0;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------ BITFIELD PACK: LIFECYCLE ------------------------ //
+// Constructs a bitfield pack whose fields are all zero
+template <auto... Widths>
+constexpr bitfield_pack<nontype_pack<Widths...>>::bitfield_pack(
+) noexcept
+: _words{}
+{
+}
+
+// Explicitly constructs a bitfield pack from a pack of values, truncated
+template <auto... Widths>
+bitfield_pack<nontype_pack<Widths...>>::bitfield_pack(
+    const value_type& value
+) noexcept
+: _words{}
+{
+    pack(value);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- BITFIELD PACK: ACCESS -------------------------- //
+// Returns a field, shifted and masked with constants
+template <auto... Widths>
+template <std::size_t Index>
+constexpr typename bitfield_pack<nontype_pack<Widths...>>::template field_type<
+    Index
+> bitfield_pack<nontype_pack<Widths...>>::get(
+) const noexcept
+{
+    constexpr size_type width = _widths[Index];
+    constexpr size_type word = _offsets[Index] / _word_bits;
+    constexpr size_type shift = _offsets[Index] % _word_bits;
+    std::uint64_t value = std::uint64_t(_words[word]) >> shift;
+    if constexpr (shift + width > _word_bits) {
+        value |= std::uint64_t(_words[word + 1]) << (_word_bits - shift);
+    }
+    return static_cast<field_type<Index>>(value & bitfield_mask(width));
+}
+
+// Replaces a field with the low bits of a value
+template <auto... Widths>
+template <std::size_t Index>
+constexpr void bitfield_pack<nontype_pack<Widths...>>::set(
+    field_type<Index> field
+) noexcept
+{
+    constexpr size_type width = _widths[Index];
+    constexpr size_type word = _offsets[Index] / _word_bits;
+    constexpr size_type shift = _offsets[Index] % _word_bits;
+    constexpr std::uint64_t mask = bitfield_mask(width);
+    const std::uint64_t value = std::uint64_t(field) & mask;
+    _words[word] = static_cast<word_type>(
+        (_words[word] & ~(mask << shift)) | (value << shift)
+    );
+    if constexpr (shift + width > _word_bits) {
+        _words[word + 1] = static_cast<word_type>(
+            (_words[word + 1] & ~(mask >> (_word_bits - shift)))
+            | (value >> (_word_bits - shift))
+        );
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- BITFIELD PACK: BULK ACCESS ----------------------- //
+// Returns all the fields: with BMI2, a single pdep spreads them to their lanes
+template <auto... Widths>
+typename bitfield_pack<nontype_pack<Widths...>>::value_type
+bitfield_pack<nontype_pack<Widths...>>::unpack(
+) const noexcept
+{
+    return _unpack(make_pack_index_sequence_v<_count>);
+}
+
+// Replaces all the fields: with BMI2, a single pext gathers them from lanes
+template <auto... Widths>
+void bitfield_pack<nontype_pack<Widths...>>::pack(
+    const value_type& value
+) noexcept
+{
+    _pack(value, make_pack_index_sequence_v<_count>);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- BITFIELD PACK: SIZE --------------------------- //
+// Returns the number of fields in the pack
+template <auto... Widths>
+constexpr typename bitfield_pack<nontype_pack<Widths...>>::size_type
+bitfield_pack<nontype_pack<Widths...>>::size(
+) noexcept
+{
+    return sizeof...(Widths);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------- BITFIELD PACK: IMPLEMENTATION DETAILS ------------------ //
+// Returns the mask selecting the bits of the fields within their lanes
+template <auto... Widths>
+template <std::size_t... Indices>
+constexpr std::uint64_t bitfield_pack<nontype_pack<Widths...>>::_lane_mask(
+    pack_index_sequence<Indices...>
+) noexcept
+{
+    return (
+        std::uint64_t(0) | ... | (bitfield_mask(Widths) << _lanes[Indices])
+    );
+}
+
+// Spreads the word to the lanes, or extracts the fields one by one
+template <auto... Widths>
+template <std::size_t... Indices>
+typename bitfield_pack<nontype_pack<Widths...>>::value_type
+bitfield_pack<nontype_pack<Widths...>>::_unpack(
+    pack_index_sequence<Indices...> indices
+) const noexcept
+{
+#if defined(PCK_HAS_BMI2)
+    if constexpr (_spreadable) {
+        const std::uint64_t lanes = _pdep_u64(_words[0], _lane_mask(indices));
+        return value_type(
+            static_cast<field_type<Indices>>(lanes >> _lanes[Indices])...
+        );
+    }
+#endif
+    static_cast<void>(indices);
+    return value_type(get<Indices>()...);
+}
+
+// Gathers the fields from the lanes, or inserts them one by one
+template <auto... Widths>
+template <std::size_t... Indices>
+void bitfield_pack<nontype_pack<Widths...>>::_pack(
+    const value_type& value,
+    pack_index_sequence<Indices...> indices
+) noexcept
+{
+#if defined(PCK_HAS_BMI2)
+    if constexpr (_spreadable) {
+        const std::uint64_t lanes = (std::uint64_t(0) | ... | (
+            std::uint64_t(value[pack_index_v<Indices>].value())
+            << _lanes[Indices]
+        ));
+        _words[0] = static_cast<word_type>(
+            _pext_u64(lanes, _lane_mask(indices))
+        );
+        return;
+    }
+#endif
+    static_cast<void>(indices);
+    (set<Indices>(value[pack_index_v<Indices>].value()), ...);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- BITFIELD VECTOR: LIFECYCLE ----------------------- //
+// Explicitly constructs a bitfield vector of the given number of zero rows
+template <auto... Widths>
+bitfield_vector<nontype_pack<Widths...>>::bitfield_vector(
+    size_type count
+)
+{
+    resize(count);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ BITFIELD VECTOR: ACCESS ------------------------- //
+// Returns a field of a row, which may cross two words of its column
+template <auto... Widths>
+template <std::size_t Index>
+typename bitfield_vector<nontype_pack<Widths...>>::template field_type<Index>
+bitfield_vector<nontype_pack<Widths...>>::get(
+    size_type position
+) const noexcept
+{
+    constexpr size_type width = _widths[Index];
+    const std::vector<std::uint64_t>& column = _columns[Index];
+    const size_type bit = position * width;
+    const size_type word = bit / 64;
+    const size_type shift = bit % 64;
+    std::uint64_t value = column[word] >> shift;
+    if (shift + width > 64) {
+        value |= column[word + 1] << (64 - shift);
+    }
+    return static_cast<field_type<Index>>(value & bitfield_mask(width));
+}
+
+// Replaces a field of a row with the low bits of a value
+template <auto... Widths>
+template <std::size_t Index>
+void bitfield_vector<nontype_pack<Widths...>>::set(
+    size_type position,
+    field_type<Index> field
+) noexcept
+{
+    constexpr size_type width = _widths[Index];
+    constexpr std::uint64_t mask = bitfield_mask(width);
+    std::vector<std::uint64_t>& column = _columns[Index];
+    const std::uint64_t value = std::uint64_t(field) & mask;
+    const size_type bit = position * width;
+    const size_type word = bit / 64;
+    const size_type shift = bit % 64;
+    column[word] = (column[word] & ~(mask << shift)) | (value << shift);
+    if (shift + width > 64) {
+        column[word + 1] = (column[word + 1] & ~(mask >> (64 - shift)))
+        | (value >> (64 - shift));
+    }
+}
+
+// Returns all the fields of a row
+template <auto... Widths>
+typename bitfield_vector<nontype_pack<Widths...>>::value_type
+bitfield_vector<nontype_pack<Widths...>>::load(
+    size_type position
+) const noexcept
+{
+    return _load(position, make_pack_index_sequence_v<_count>);
+}
+
+// Replaces all the fields of a row
+template <auto... Widths>
+void bitfield_vector<nontype_pack<Widths...>>::store(
+    size_type position,
+    const value_type& value
+) noexcept
+{
+    _store(position, value, make_pack_index_sequence_v<_count>);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- BITFIELD VECTOR: MODIFIERS ----------------------- //
+// Appends a row
+template <auto... Widths>
+void bitfield_vector<nontype_pack<Widths...>>::push_back(
+    const value_type& value
+)
+{
+    resize(_size + 1);
+    store(_size - 1, value);
+}
+
+// Changes the number of rows, the new ones being zero
+template <auto... Widths>
+void bitfield_vector<nontype_pack<Widths...>>::resize(
+    size_type count
+)
+{
+    for (size_type i = 0; i < _count; ++i) {
+        const size_type bit = count * _widths[i];
+        _columns[i].resize(_words(count, _widths[i]));
+        if (count < _size && bit % 64 != 0) {
+            _columns[i][bit / 64] &= bitfield_mask(bit % 64);
+        }
+    }
+    _size = count;
+}
+
+// Reserves the columns for the given number of rows
+template <auto... Widths>
+void bitfield_vector<nontype_pack<Widths...>>::reserve(
+    size_type count
+)
+{
+    for (size_type i = 0; i < _count; ++i) {
+        _columns[i].reserve(_words(count, _widths[i]));
+    }
+}
+
+// Removes all the rows
+template <auto... Widths>
+void bitfield_vector<nontype_pack<Widths...>>::clear(
+) noexcept
+{
+    for (std::vector<std::uint64_t>& column : _columns) {
+        column.clear();
+    }
+    _size = 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- BITFIELD VECTOR: CAPACITY ------------------------ //
+// Returns the number of rows
+template <auto... Widths>
+typename bitfield_vector<nontype_pack<Widths...>>::size_type
+bitfield_vector<nontype_pack<Widths...>>::size(
+) const noexcept
+{
+    return _size;
+}
+
+// Checks whether there are no rows
+template <auto... Widths>
+bool bitfield_vector<nontype_pack<Widths...>>::empty(
+) const noexcept
+{
+    return _size == 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------- BITFIELD VECTOR: IMPLEMENTATION DETAILS ----------------- //
+// Returns the number of words of a column of the given number of rows
+template <auto... Widths>
+constexpr typename bitfield_vector<nontype_pack<Widths...>>::size_type
+bitfield_vector<nontype_pack<Widths...>>::_words(
+    size_type count,
+    size_type width
+) noexcept
+{
+    return (count * width + 63) / 64;
+}
+
+// Extracts the fields of a row one by one
+template <auto... Widths>
+template <std::size_t... Indices>
+typename bitfield_vector<nontype_pack<Widths...>>::value_type
+bitfield_vector<nontype_pack<Widths...>>::_load(
+    size_type position,
+    pack_index_sequence<Indices...>
+) const noexcept
+{
+    return value_type(get<Indices>(position)...);
+}
+
+// Inserts the fields of a row one by one
+template <auto... Widths>
+template <std::size_t... Indices>
+void bitfield_vector<nontype_pack<Widths...>>::_store(
+    size_type position,
+    const value_type& value,
+    pack_index_sequence<Indices...>
+) noexcept
+{
+    (set<Indices>(position, value[pack_index_v<Indices>].value()), ...);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _BITFIELD_PACK_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,389 @@
+// ============================= MESSAGE QUEUE ============================== //
+// Project:         Pack
+// Name:            message_queue.hpp
+// Description:     Bounded lock-free queue of messages of the types of a pack
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _MESSAGE_QUEUE_HPP_INCLUDED
+#define _MESSAGE_QUEUE_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <new>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+// Project sources
+#include "pack_details.hpp"
+#include "type_pack.hpp"
+#include "pack_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ***************************** MESSAGE QUEUE ****************************** */
+// Message queue class declaration
+template <class Messages, std::size_t Capacity = 1024>
+class message_queue;
+
+// Message queue class definition: a ring of slots fitting any message
+template <class... Messages, std::size_t Capacity>
+class message_queue<type_pack<Messages...>, Capacity>
+{
+    // Types
+    public:
+    using size_type = std::size_t;
+    using index_type = std::conditional_t<
+        (sizeof...(Messages) <= UINT8_MAX),
+        std::uint8_t,
+        std::conditional_t<
+            (sizeof...(Messages) <= UINT16_MAX),
+            std::uint16_t,
+            std::uint32_t
+        >
+    >;
+
+    // Lifecycle
+    public:
+    message_queue() noexcept;
+    message_queue(const message_queue&) = delete;
+    message_queue& operator=(const message_queue&) = delete;
+    ~message_queue();
+
+    // Producers
+    public:
+    template <class Message, class... Args>
+    bool try_emplace(Args&&...);
+    template <class Message>
+    bool try_push(Message&&);
+    template <class ForwardIt>
+    ForwardIt try_push_n(ForwardIt, ForwardIt);
+
+    // Consumers
+    public:
+    template <class Visitor>
+    bool try_pop(Visitor&&);
+    template <class Visitor>
+    size_type try_pop_n(Visitor&&, size_type);
+
+    // Capacity
+    public:
+    static constexpr size_type capacity() noexcept;
+
+    // Implementation details: messages
+    private:
+    static_assert(Capacity > 0, "capacity should be positive");
+    static_assert((Capacity & (Capacity - 1)) == 0, "capacity should be 2^n");
+    static_assert(
+        (std::is_nothrow_move_constructible_v<Messages> && ...),
+        "messages should be nothrow move constructible"
+    );
+    template <class Message>
+    static constexpr index_type _index() noexcept;
+    template <class Message>
+    static void _destroy(void*) noexcept;
+    template <class Visitor, class Message>
+    static void _visit(Visitor&, void*);
+
+    // Implementation details: slots
+    private:
+    static constexpr size_type _mask = Capacity - 1;
+    static constexpr size_type _storage_size = std::max({sizeof(Messages)...});
+    static constexpr size_type _storage_alignment = std::max({
+        alignof(Messages)...
+    });
+    struct _slot_type {
+        std::atomic<size_type> sequence;
+        index_type index;
+        alignas(_storage_alignment) std::byte storage[_storage_size];
+    };
+    size_type _claim(
+        std::atomic<size_type>&,
+        size_type,
+        size_type&,
+        size_type
+    ) noexcept;
+    void _release(size_type) noexcept;
+
+    // Implementation details: data members, one cache line per cursor
+    private:
+    alignas(cache_line_size) std::atomic<size_type> _head;
+    alignas(cache_line_size) std::atomic<size_type> _tail;
+    alignas(cache_line_size) std::array<_slot_type, Capacity> _slots;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------ MESSAGE QUEUE: LIFECYCLE ------------------------ //
+// Constructs an empty queue: the sequence of a slot is its next position
+template <class... Messages, std::size_t Capacity>
+message_queue<type_pack<Messages...>, Capacity>::message_queue(
+) noexcept
+: _head(0)
+, _tail(0)
+{
+    for (size_type i = 0; i < Capacity; ++i) {
+        _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+// Destroys the messages that have not been popped
+template <class... Messages, std::size_t Capacity>
+message_queue<type_pack<Messages...>, Capacity>::~message_queue(
+)
+{
+    using destructor_type = void (*)(void*) noexcept;
+    constexpr destructor_type destructors[] = {&_destroy<Messages>...};
+    const size_type tail = _tail.load(std::memory_order_acquire);
+    for (size_type i = _head.load(std::memory_order_acquire); i != tail; ++i) {
+        _slot_type& slot = _slots[i & _mask];
+        destructors[slot.index](slot.storage);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ MESSAGE QUEUE: PRODUCERS ------------------------ //
+// Constructs a message in a free slot, or returns false if the queue is full
+// Messages that may throw are constructed before claiming the slot
+template <class... Messages, std::size_t Capacity>
+template <class Message, class... Args>
+bool message_queue<type_pack<Messages...>, Capacity>::try_emplace(
+    Args&&... args
+)
+{
+    constexpr index_type index = _index<Message>();
+    size_type position = 0;
+    if constexpr (std::is_nothrow_constructible_v<Message, Args...>) {
+        if (_claim(_tail, 0, position, 1) == 0) {
+            return false;
+        }
+        _slot_type& slot = _slots[position & _mask];
+        ::new (static_cast<void*>(slot.storage)) Message(
+            std::forward<Args>(args)...
+        );
+        slot.index = index;
+        slot.sequence.store(position + 1, std::memory_order_release);
+        return true;
+    } else if constexpr (std::is_constructible_v<Message, Args...>) {
+        return try_push(Message(std::forward<Args>(args)...));
+    } else {
+        return try_push(Message{std::forward<Args>(args)...});
+    }
+}
+
+// Pushes a message, or returns false if the queue is full
+template <class... Messages, std::size_t Capacity>
+template <class Message>
+bool message_queue<type_pack<Messages...>, Capacity>::try_push(
+    Message&& message
+)
+{
+    return try_emplace<std::decay_t<Message>>(std::forward<Message>(message));
+}
+
+// Moves as many messages as fit into slots claimed at once
+template <class... Messages, std::size_t Capacity>
+template <class ForwardIt>
+ForwardIt message_queue<type_pack<Messages...>, Capacity>::try_push_n(
+    ForwardIt first,
+    ForwardIt last
+)
+{
+    using message_type = typename std::iterator_traits<ForwardIt>::value_type;
+    constexpr index_type index = _index<message_type>();
+    const size_type size = static_cast<size_type>(std::distance(first, last));
+    size_type position = 0;
+    const size_type count = _claim(_tail, 0, position, size);
+    for (size_type i = 0; i < count; ++i, ++first) {
+        _slot_type& slot = _slots[(position + i) & _mask];
+        ::new (static_cast<void*>(slot.storage)) message_type(
+            std::move(*first)
+        );
+        slot.index = index;
+        slot.sequence.store(position + i + 1, std::memory_order_release);
+    }
+    return first;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ MESSAGE QUEUE: CONSUMERS ------------------------ //
+// Hands the front message to a visitor, or returns false if there is none
+template <class... Messages, std::size_t Capacity>
+template <class Visitor>
+bool message_queue<type_pack<Messages...>, Capacity>::try_pop(
+    Visitor&& visitor
+)
+{
+    return try_pop_n(std::forward<Visitor>(visitor), 1) != 0;
+}
+
+// Hands at most count messages claimed at once to a visitor, in order
+template <class... Messages, std::size_t Capacity>
+template <class Visitor>
+typename message_queue<type_pack<Messages...>, Capacity>::size_type
+message_queue<type_pack<Messages...>, Capacity>::try_pop_n(
+    Visitor&& visitor,
+    size_type count
+)
+{
+    using visitor_type = std::remove_reference_t<Visitor>;
+    using function_type = void (*)(visitor_type&, void*);
+    using destructor_type = void (*)(void*) noexcept;
+    constexpr function_type functions[] = {
+        &_visit<visitor_type, Messages>...
+    };
+    constexpr destructor_type destructors[] = {&_destroy<Messages>...};
+    size_type position = 0;
+    count = _claim(_head, 1, position, count);
+    for (size_type i = 0; i < count; ++i) {
+        _slot_type& slot = _slots[(position + i) & _mask];
+        try {
+            functions[slot.index](visitor, slot.storage);
+        } catch (...) {
+            for (size_type j = i; j < count; ++j) {
+                _slot_type& rest = _slots[(position + j) & _mask];
+                destructors[rest.index](rest.storage);
+                _release(position + j);
+            }
+            throw;
+        }
+        destructors[slot.index](slot.storage);
+        _release(position + i);
+    }
+    return count;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ MESSAGE QUEUE: CAPACITY ------------------------- //
+// Returns the maximum number of messages in the queue
+template <class... Messages, std::size_t Capacity>
+constexpr typename message_queue<type_pack<Messages...>, Capacity>::size_type
+message_queue<type_pack<Messages...>, Capacity>::capacity(
+) noexcept
+{
+    return Capacity;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------- MESSAGE QUEUE: IMPLEMENTATION DETAILS ------------------ //
+// Returns the index of a message type in the pack
+template <class... Messages, std::size_t Capacity>
+template <class Message>
+constexpr typename message_queue<type_pack<Messages...>, Capacity>::index_type
+message_queue<type_pack<Messages...>, Capacity>::_index(
+) noexcept
+{
+    constexpr size_type index = type_id_table<Messages...>::find(
+        &type_tag<Message>
+    );
+    static_assert(index < sizeof...(Messages), "unknown message type");
+    return static_cast<index_type>(index);
+}
+
+// Destroys the message of the given type in a slot
+template <class... Messages, std::size_t Capacity>
+template <class Message>
+void message_queue<type_pack<Messages...>, Capacity>::_destroy(
+    void* storage
+) noexcept
+{
+    std::launder(static_cast<Message*>(storage))->~Message();
+}
+
+// Hands the message of the given type in a slot to a visitor
+template <class... Messages, std::size_t Capacity>
+template <class Visitor, class Message>
+void message_queue<type_pack<Messages...>, Capacity>::_visit(
+    Visitor& visitor,
+    void* storage
+)
+{
+    std::invoke(visitor, std::move(*std::launder(static_cast<Message*>(
+        storage
+    ))));
+}
+
+// Claims consecutive slots whose sequences are ahead of them by the offset
+template <class... Messages, std::size_t Capacity>
+typename message_queue<type_pack<Messages...>, Capacity>::size_type
+message_queue<type_pack<Messages...>, Capacity>::_claim(
+    std::atomic<size_type>& cursor,
+    size_type offset,
+    size_type& position,
+    size_type count
+) noexcept
+{
+    using difference_type = std::make_signed_t<size_type>;
+    position = cursor.load(std::memory_order_relaxed);
+    while (count != 0) {
+        const size_type sequence = _slots[position & _mask].sequence.load(
+            std::memory_order_acquire
+        );
+        const auto lag = static_cast<difference_type>(
+            sequence - (position + offset)
+        );
+        if (lag < 0) {
+            return 0;
+        } else if (lag > 0) {
+            position = cursor.load(std::memory_order_relaxed);
+            continue;
+        }
+        size_type ready = 1;
+        for (; ready < count && ready < Capacity; ++ready) {
+            const _slot_type& slot = _slots[(position + ready) & _mask];
+            if (slot.sequence.load(std::memory_order_acquire)
+                != position + ready + offset) {
+                break;
+            }
+        }
+        if (cursor.compare_exchange_weak(
+            position,
+            position + ready,
+            std::memory_order_relaxed
+        )) {
+            return ready;
+        }
+    }
+    return 0;
+}
+
+// Hands a popped slot back to the producers, one lap later
+template <class... Messages, std::size_t Capacity>
+void message_queue<type_pack<Messages...>, Capacity>::_release(
+    size_type position
+) noexcept
+{
+    _slots[position & _mask].sequence.store(
+        position + Capacity,
+        std::memory_order_release
+    );
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _MESSAGE_QUEUE_HPP_INCLUDED
+// ========================================================================== //
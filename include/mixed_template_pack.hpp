@@ -61,7 +61,7 @@ class mixed_template_pack_element
     using index_type = Index;
     template <class Type, auto... Nontypes>
     using key_type = Key<Type, Nontypes...>;
-    static constexpr auto index = index_type::value;
+    static constexpr std::size_t index = index_type::value;
 
     // Lifecycle
     public:
@@ -105,12 +105,31 @@ class mixed_template_pack_base<
 >
 : mixed_template_pack_element<Templates, pack_index<Indices>>...
 {
-    // Inheritance
+    // Access
     public:
-    using mixed_template_pack_element<
-        Templates,
-        pack_index<Indices>
-    >::operator[]...;
+    template <std::size_t Index>
+    constexpr auto operator[](pack_index<Index>) const noexcept;
+    template <template <class, auto...> class K, class Arg, auto... Args>
+    constexpr auto operator[](const K<Arg, Args...>&) const noexcept;
+
+    // Implementation details: element lookup, deduced from a single base
+    private:
+    template <
+        std::size_t Index,
+        template <class, auto...> class Template,
+        template <class, auto...> class Key
+    >
+    static constexpr auto _at(
+        const mixed_template_pack_element<Template, pack_index<Index>, Key>&
+    ) noexcept;
+    template <
+        template <class, auto...> class Key,
+        template <class, auto...> class Template,
+        class Index
+    >
+    static constexpr auto _find(
+        const mixed_template_pack_element<Template, Index, Key>&
+    ) noexcept;
 
     // Implementation details: types and constants
     private:
@@ -258,6 +277,70 @@ mixed_template_pack_element<Template, Index, Key>::operator[](
 
 
 
+// -------------------- MIXED TEMPLATE PACK BASE: ACCESS -------------------- //
+// Returns the mixed template pack element corresponding to the index
+template <std::size_t... Indices, template <class, auto...> class... Templates>
+template <std::size_t Index>
+constexpr auto
+mixed_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+operator[](
+    pack_index<Index>
+) const noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Returns the mixed template pack element corresponding to the key
+template <std::size_t... Indices, template <class, auto...> class... Templates>
+template <template <class, auto...> class K, class Arg, auto... Args>
+constexpr auto
+mixed_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+operator[](
+    const K<Arg, Args...>&
+) const noexcept
+{
+    return _find<K>(*this);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------ MIXED TEMPLATE PACK BASE: IMPLEMENTATION DETAILS ------------ //
+// Returns the element at the index, the only base that can be deduced
+template <std::size_t... Indices, template <class, auto...> class... Templates>
+template <
+    std::size_t Index,
+    template <class, auto...> class Template,
+    template <class, auto...> class Key
+>
+constexpr auto
+mixed_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+_at(
+    const mixed_template_pack_element<Template, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
+
+// Returns the element of the key, deduction failing for duplicate keys
+template <std::size_t... Indices, template <class, auto...> class... Templates>
+template <
+    template <class, auto...> class Key,
+    template <class, auto...> class Template,
+    class Index
+>
+constexpr auto
+mixed_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+_find(
+    const mixed_template_pack_element<Template, Index, Key>& base
+) noexcept
+{
+    return base;
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // --------------------- MIXED TEMPLATE PACK: LIFECYCLE --------------------- //
 // Explicitly constructs a template pack from objects of these types
 template <template <class, auto...> class... Templates>
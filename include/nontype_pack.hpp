@@ -42,7 +42,8 @@ class nontype_pack_element
     using type = decltype(Nontype);
     using index_type = Index;
     using key_type = decltype(Key);
-    static constexpr auto index = index_type::value;
+    static constexpr std::size_t index = index_type::value;
+    static constexpr type value = Nontype;
 
     // Lifecycle
     public:
@@ -92,9 +93,23 @@ template <std::size_t... Indices, auto... Nontypes>
 class nontype_pack_base<pack_index_sequence<Indices...>, Nontypes...>
 : nontype_pack_element<Nontypes, pack_index<Indices>>...
 {
-    // Inheritance
+    // Access
     public:
-    using nontype_pack_element<Nontypes, pack_index<Indices>>::operator[]...;
+    template <std::size_t Index>
+    constexpr auto operator[](pack_index<Index>) const noexcept;
+    template <class K>
+    constexpr auto operator[](const K&) const noexcept;
+
+    // Implementation details: element lookup, deduced from a single base
+    private:
+    template <std::size_t Index, auto Nontype, auto Key>
+    static constexpr auto _at(
+        const nontype_pack_element<Nontype, pack_index<Index>, Key>&
+    ) noexcept;
+    template <auto Key, auto Nontype, class Index>
+    static constexpr auto _find(
+        const nontype_pack_element<Nontype, Index, Key>&
+    ) noexcept;
 
     // Implementation details: types and constants
     private:
@@ -103,6 +118,7 @@ class nontype_pack_base<pack_index_sequence<Indices...>, Nontypes...>
     using index_type = void;
     using key_type = void;
     static constexpr std::size_t index = -1;
+    static constexpr std::nullptr_t value = nullptr;
 };
 /* ************************************************************************** */
 
@@ -120,7 +136,7 @@ class nontype_pack
     static constexpr bool _has_equal_value_v = Arg::value == Value;
     template <class... Args>
     using _if_constructible_from_t = std::enable_if_t<
-        (_has_equal_value_v<Args, Nontypes> && ...)
+        pack_conjunction_v<_has_equal_value_v<Args, Nontypes>...>
     >;
     
     // Types and inheritance
@@ -211,6 +227,58 @@ nontype_pack_element<Nontype, Index, Key>::operator[](
 
 
 
+// ----------------------- NONTYPE PACK BASE: ACCESS ------------------------ //
+// Returns the non-type pack element corresponding to the index
+template <std::size_t... Indices, auto... Nontypes>
+template <std::size_t Index>
+constexpr auto
+nontype_pack_base<pack_index_sequence<Indices...>, Nontypes...>::operator[](
+    pack_index<Index>
+) const noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Returns the non-type pack element corresponding to the key
+template <std::size_t... Indices, auto... Nontypes>
+template <class K>
+constexpr auto
+nontype_pack_base<pack_index_sequence<Indices...>, Nontypes...>::operator[](
+    const K&
+) const noexcept
+{
+    return _find<K::value>(*this);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------- NONTYPE PACK BASE: IMPLEMENTATION DETAILS ---------------- //
+// Returns the element at the index, the only base that can be deduced
+template <std::size_t... Indices, auto... Nontypes>
+template <std::size_t Index, auto Nontype, auto Key>
+constexpr auto
+nontype_pack_base<pack_index_sequence<Indices...>, Nontypes...>::_at(
+    const nontype_pack_element<Nontype, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
+
+// Returns the element of the key, deduction failing for duplicate keys
+template <std::size_t... Indices, auto... Nontypes>
+template <auto Key, auto Nontype, class Index>
+constexpr auto
+nontype_pack_base<pack_index_sequence<Indices...>, Nontypes...>::_find(
+    const nontype_pack_element<Nontype, Index, Key>& base
+) noexcept
+{
+    return base;
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ------------------------ NONTYPE PACK: LIFECYCLE ------------------------- //
 // Explicitly constructs a non-type pack from constant values
 template <auto... Nontypes>
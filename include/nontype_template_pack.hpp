@@ -57,7 +57,7 @@ class nontype_template_pack_element
     using index_type = Index;
     template <auto... Nontypes>
     using key_type = Key<Nontypes...>;
-    static constexpr auto index = index_type::value;
+    static constexpr std::size_t index = index_type::value;
 
     // Lifecycle
     public:
@@ -101,12 +101,31 @@ class nontype_template_pack_base<
 >
 : nontype_template_pack_element<Templates, pack_index<Indices>>...
 {
-    // Inheritance
+    // Access
     public:
-    using nontype_template_pack_element<
-        Templates,
-        pack_index<Indices>
-    >::operator[]...;
+    template <std::size_t Index>
+    constexpr auto operator[](pack_index<Index>) const noexcept;
+    template <template <auto...> class K, auto... Args>
+    constexpr auto operator[](const K<Args...>&) const noexcept;
+
+    // Implementation details: element lookup, deduced from a single base
+    private:
+    template <
+        std::size_t Index,
+        template <auto...> class Template,
+        template <auto...> class Key
+    >
+    static constexpr auto _at(
+        const nontype_template_pack_element<Template, pack_index<Index>, Key>&
+    ) noexcept;
+    template <
+        template <auto...> class Key,
+        template <auto...> class Template,
+        class Index
+    >
+    static constexpr auto _find(
+        const nontype_template_pack_element<Template, Index, Key>&
+    ) noexcept;
 
     // Implementation details: types and constants
     private:
@@ -254,6 +273,70 @@ nontype_template_pack_element<Template, Index, Key>::operator[](
 
 
 
+// ------------------- NONTYPE TEMPLATE PACK BASE: ACCESS ------------------- //
+// Returns the nontype template pack element corresponding to the index
+template <std::size_t... Indices, template <auto...> class... Templates>
+template <std::size_t Index>
+constexpr auto
+nontype_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+operator[](
+    pack_index<Index>
+) const noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Returns the nontype template pack element corresponding to the key
+template <std::size_t... Indices, template <auto...> class... Templates>
+template <template <auto...> class K, auto... Args>
+constexpr auto
+nontype_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+operator[](
+    const K<Args...>&
+) const noexcept
+{
+    return _find<K>(*this);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------- NONTYPE TEMPLATE PACK BASE: IMPLEMENTATION DETAILS ----------- //
+// Returns the element at the index, the only base that can be deduced
+template <std::size_t... Indices, template <auto...> class... Templates>
+template <
+    std::size_t Index,
+    template <auto...> class Template,
+    template <auto...> class Key
+>
+constexpr auto
+nontype_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+_at(
+    const nontype_template_pack_element<Template, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
+
+// Returns the element of the key, deduction failing for duplicate keys
+template <std::size_t... Indices, template <auto...> class... Templates>
+template <
+    template <auto...> class Key,
+    template <auto...> class Template,
+    class Index
+>
+constexpr auto
+nontype_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+_find(
+    const nontype_template_pack_element<Template, Index, Key>& base
+) noexcept
+{
+    return base;
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // -------------------- NONTYPE TEMPLATE PACK: LIFECYCLE -------------------- //
 // Explicitly constructs a template pack from objects of these types
 template <template <auto...> class... Templates>
@@ -14,35 +14,240 @@
 
 // ================================ PREAMBLE ================================ //
 // C++ standard library
+#include <tuple>
+#include <memory>
+#include <cstring>
+#include <utility>
+#include <type_traits>
 // Project sources
 #include "pack_details.hpp"
 #include "pack_index.hpp"
 // Third-party libraries
 // Miscellaneous
 namespace pck {
+template <class Type, class Index, class Key = Type>
+class object_pack_element;
+template <class, class...>
+class object_pack_base;
+template <class... Types>
+class object_pack;
+template <class, class...>
+class pack_expression;
 // ========================================================================== //
 
 
 
+/* ***************************** UNINITIALIZED ****************************** */
+// Uninitialized tag structure definition
+struct uninitialized_t
+{
+    explicit constexpr uninitialized_t() noexcept = default;
+};
+
+// Uninitialized tag constant
+inline constexpr uninitialized_t uninitialized{};
+/* ************************************************************************** */
+
+
+
+/* ************************ IS TRIVIALLY RELOCATABLE ************************ */
+// Is trivially relocatable declaration: opt-in through specialization
+template <class Type>
+struct is_trivially_relocatable
+: std::bool_constant<std::is_trivially_copyable_v<Type>>
+{
+};
+
+// Is trivially relocatable specialization: object pack element
+template <class Type, class Index, class Key>
+struct is_trivially_relocatable<object_pack_element<Type, Index, Key>>
+: is_trivially_relocatable<Type>
+{
+};
+
+// Is trivially relocatable specialization: object pack base
+template <std::size_t... Indices, class... Types>
+struct is_trivially_relocatable<
+    object_pack_base<pack_index_sequence<Indices...>, Types...>
+>
+: std::bool_constant<
+    pack_conjunction_v<is_trivially_relocatable<Types>::value...>
+>
+{
+};
+
+// Is trivially relocatable specialization: object pack
+template <class... Types>
+struct is_trivially_relocatable<object_pack<Types...>>
+: std::bool_constant<
+    pack_conjunction_v<is_trivially_relocatable<Types>::value...>
+>
+{
+};
+
+// Variable template
+template <class Type>
+inline constexpr bool is_trivially_relocatable_v
+= is_trivially_relocatable<Type>::value;
+/* ************************************************************************** */
+
+
+
+/* ********************* IS OBJECT PACK CONSTRUCTIBLE *********************** */
+// Is object pack constructible declaration
+template <class, class...>
+struct is_object_pack_constructible
+: std::false_type
+{
+};
+
+// Is object pack constructible specialization: object pack element
+template <class Type, class Index, class Key, class Arg>
+struct is_object_pack_constructible<object_pack_element<Type, Index, Key>, Arg>
+: std::bool_constant<
+    std::is_constructible_v<Type, Arg> &&
+    !std::is_base_of_v<
+        object_pack_element<Type, Index, Key>,
+        std::remove_cv_t<std::remove_reference_t<Arg>>
+    > &&
+    !std::is_same_v<
+        std::remove_cv_t<std::remove_reference_t<Arg>>,
+        uninitialized_t
+    > &&
+    !std::is_same_v<
+        std::remove_cv_t<std::remove_reference_t<Arg>>,
+        std::allocator_arg_t
+    >
+>
+{
+};
+
+// Is object pack constructible specialization: elements from as many args
+template <class... Elements, class... Args>
+struct is_object_pack_constructible<
+    std::tuple<Elements...>,
+    std::tuple<Args...>
+>
+: std::bool_constant<
+    pack_conjunction_v<is_object_pack_constructible<Elements, Args>::value...>
+>
+{
+};
+
+// Is object pack constructible specialization: object pack base
+template <std::size_t... Indices, class... Types, class... Args>
+struct is_object_pack_constructible<
+    object_pack_base<pack_index_sequence<Indices...>, Types...>,
+    Args...
+>
+: std::conjunction<
+    std::bool_constant<sizeof...(Types) == sizeof...(Args)>,
+    std::bool_constant<pack_conjunction_v<!std::is_base_of_v<
+        object_pack_base<pack_index_sequence<Indices...>, Types...>,
+        std::remove_cv_t<std::remove_reference_t<Args>>
+    >...>>,
+    is_object_pack_constructible<
+        std::tuple<object_pack_element<Types, pack_index<Indices>>...>,
+        std::tuple<Args...>
+    >
+>
+{
+};
+
+// Is object pack constructible specialization: object pack
+template <class... Types, class... Args>
+struct is_object_pack_constructible<object_pack<Types...>, Args...>
+: is_object_pack_constructible<
+    object_pack_base<make_pack_index_sequence<sizeof...(Types)>, Types...>,
+    Args...
+>
+{
+};
+
+// Variable template
+template <class Pack, class... Args>
+inline constexpr bool is_object_pack_constructible_v
+= is_object_pack_constructible<Pack, Args...>::value;
+
+// Alias template
+template <class Pack, class... Args>
+using if_object_pack_constructible_t = std::enable_if_t<
+    is_object_pack_constructible_v<Pack, Args...>
+>;
+/* ************************************************************************** */
+
+
+
 /* ************************** OBJECT PACK ELEMENT *************************** */
 // Object pack element definition
-template <class Type, class Index, class Key = Type>
+template <class Type, class Index, class Key>
 class object_pack_element
 {
+    // Implementation details: type traits
+    private:
+    template <class Arg>
+    using _if_constructible_from_t = if_object_pack_constructible_t<
+        object_pack_element,
+        Arg
+    >;
+    static constexpr bool _is_nothrow_default_constructible_v
+    = std::is_nothrow_default_constructible_v<Type>;
+    static constexpr bool _is_nothrow_copy_constructible_v
+    = std::is_nothrow_copy_constructible_v<Type>;
+    template <class Arg>
+    static constexpr bool _is_nothrow_constructible_from_v
+    = std::is_nothrow_constructible_v<Type, Arg>;
+
     // Types and constants
     public:
     using element_type = object_pack_element;
     using type = Type;
     using index_type = Index;
     using key_type = Key;
-    static constexpr auto index = index_type::value;
+    static constexpr std::size_t index = index_type::value;
 
     // Lifecycle
     public:
-    constexpr object_pack_element();
-    explicit constexpr object_pack_element(const type&);
-    constexpr object_pack_element(const type&, index_type);
-    constexpr object_pack_element(const type&, index_type, const key_type&);
+    constexpr object_pack_element() = default;
+    explicit constexpr object_pack_element(
+        uninitialized_t
+    ) noexcept(_is_nothrow_default_constructible_v);
+    explicit constexpr object_pack_element(
+        const type&
+    ) noexcept(_is_nothrow_copy_constructible_v);
+    template <class Arg, class = _if_constructible_from_t<Arg&&>>
+    explicit constexpr object_pack_element(
+        Arg&&
+    ) noexcept(_is_nothrow_constructible_from_v<Arg&&>);
+    constexpr object_pack_element(
+        const type&,
+        index_type
+    ) noexcept(_is_nothrow_copy_constructible_v);
+    constexpr object_pack_element(
+        const type&,
+        index_type,
+        const key_type&
+    ) noexcept(_is_nothrow_copy_constructible_v);
+    template <class Alloc>
+    constexpr object_pack_element(std::allocator_arg_t, const Alloc&);
+    template <class Alloc>
+    constexpr object_pack_element(
+        std::allocator_arg_t,
+        const Alloc&,
+        const type&
+    );
+    template <class Alloc>
+    constexpr object_pack_element(
+        std::allocator_arg_t,
+        const Alloc&,
+        const object_pack_element&
+    );
+    template <class Alloc>
+    constexpr object_pack_element(
+        std::allocator_arg_t,
+        const Alloc&,
+        object_pack_element&&
+    );
 
     // Access
     public:
@@ -51,6 +256,18 @@ class object_pack_element
     constexpr element_type& operator[](const key_type&) noexcept;
     constexpr const element_type& operator[](const key_type&) const noexcept;
 
+    // Value
+    public:
+    constexpr type& value() & noexcept;
+    constexpr const type& value() const& noexcept;
+    constexpr type&& value() && noexcept;
+    constexpr const type&& value() const&& noexcept;
+
+    // Implementation details: uses-allocator construction
+    private:
+    template <class Alloc, class... Args>
+    static constexpr type _make_using_allocator(const Alloc&, Args&&...);
+
     // Implementation details: data members
     private:
     type _object;
@@ -60,23 +277,93 @@ class object_pack_element
 
 
 /* **************************** OBJECT PACK BASE **************************** */
-// Object pack base class declaration
-template <class, class...>
-class object_pack_base;
-
 // Object pack base class specialization
 template <std::size_t... Indices, class... Types>
 class object_pack_base<pack_index_sequence<Indices...>, Types...>
 : object_pack_element<Types, pack_index<Indices>>...
 {
-    // Inheritance
-    public:
-    using object_pack_element<Types, pack_index<Indices>>::operator[]...;
+    // Implementation details: type traits
+    private:
+    template <class... Args>
+    using _if_constructible_from_t = if_object_pack_constructible_t<
+        object_pack_base,
+        Args...
+    >;
+    static constexpr bool _is_nothrow_default_constructible_v
+    = pack_conjunction_v<std::is_nothrow_default_constructible_v<Types>...>;
+    static constexpr bool _is_nothrow_copy_constructible_v
+    = pack_conjunction_v<std::is_nothrow_copy_constructible_v<Types>...>;
+    template <class... Args>
+    static constexpr bool _is_nothrow_constructible_from_v
+    = pack_conjunction_v<std::is_nothrow_constructible_v<Types, Args>...>;
 
     // Lifecycle
     public:
     constexpr object_pack_base() = default;
-    explicit constexpr object_pack_base(const Types&...);
+    explicit constexpr object_pack_base(
+        uninitialized_t
+    ) noexcept(_is_nothrow_default_constructible_v);
+    explicit constexpr object_pack_base(
+        const Types&...
+    ) noexcept(_is_nothrow_copy_constructible_v);
+    template <class... Args, class = _if_constructible_from_t<Args&&...>>
+    explicit constexpr object_pack_base(
+        Args&&...
+    ) noexcept(_is_nothrow_constructible_from_v<Args&&...>);
+    template <class Alloc>
+    constexpr object_pack_base(std::allocator_arg_t, const Alloc&);
+    template <class Alloc>
+    explicit constexpr object_pack_base(
+        std::allocator_arg_t,
+        const Alloc&,
+        const Types&...
+    );
+    template <class Alloc>
+    constexpr object_pack_base(
+        std::allocator_arg_t,
+        const Alloc&,
+        const object_pack_base&
+    );
+    template <class Alloc>
+    constexpr object_pack_base(
+        std::allocator_arg_t,
+        const Alloc&,
+        object_pack_base&&
+    );
+
+    // Access
+    public:
+    template <std::size_t Index>
+    constexpr auto& operator[](pack_index<Index>) noexcept;
+    template <std::size_t Index>
+    constexpr const auto& operator[](pack_index<Index>) const noexcept;
+    template <class Key>
+    constexpr auto& operator[](Key&&) noexcept;
+    template <class Key>
+    constexpr const auto& operator[](Key&&) const noexcept;
+
+    // Implementation details: element lookup, deduced from a single base
+    private:
+    template <std::size_t Index, class Type, class Key>
+    static constexpr auto& _at(
+        object_pack_element<Type, pack_index<Index>, Key>&
+    ) noexcept;
+    template <std::size_t Index, class Type, class Key>
+    static constexpr const auto& _at(
+        const object_pack_element<Type, pack_index<Index>, Key>&
+    ) noexcept;
+
+    // Implementation details: key lookup in unevaluated contexts, an exact key
+    // deducing a single base, and any other key being resolved as an overload
+    private:
+    template <class Key, class Type, class Index>
+    static Index _find(const volatile object_pack_element<
+        Type, Index, std::remove_reference_t<Key>
+    >*);
+    template <class Key>
+    static pack_key_table<
+        Key, pack_index_sequence<Indices...>, Types...
+    > _find(const volatile void*);
 
     // Implementation details: types and constants
     private:
@@ -96,6 +383,21 @@ template <class... Types>
 class object_pack
 : object_pack_base<make_pack_index_sequence<sizeof...(Types)>, Types...>
 {
+    // Implementation details: type traits
+    private:
+    template <class... Args>
+    using _if_constructible_from_t = if_object_pack_constructible_t<
+        object_pack,
+        Args...
+    >;
+    static constexpr bool _is_nothrow_default_constructible_v
+    = pack_conjunction_v<std::is_nothrow_default_constructible_v<Types>...>;
+    static constexpr bool _is_nothrow_copy_constructible_v
+    = pack_conjunction_v<std::is_nothrow_copy_constructible_v<Types>...>;
+    template <class... Args>
+    static constexpr bool _is_nothrow_constructible_from_v
+    = pack_conjunction_v<std::is_nothrow_constructible_v<Types, Args>...>;
+
     // Types and inheritance
     public:
     using size_type = std::size_t;
@@ -106,22 +408,99 @@ class object_pack
     // Lifecycle
     public:
     constexpr object_pack() = default;
-    explicit constexpr object_pack(const Types&...);
+    explicit constexpr object_pack(
+        uninitialized_t
+    ) noexcept(_is_nothrow_default_constructible_v);
+    explicit constexpr object_pack(
+        const Types&...
+    ) noexcept(_is_nothrow_copy_constructible_v);
+    template <class... Args, class = _if_constructible_from_t<Args&&...>>
+    explicit constexpr object_pack(
+        Args&&...
+    ) noexcept(_is_nothrow_constructible_from_v<Args&&...>);
+    template <class Alloc>
+    constexpr object_pack(std::allocator_arg_t, const Alloc&);
+    template <class Alloc>
+    explicit constexpr object_pack(
+        std::allocator_arg_t,
+        const Alloc&,
+        const Types&...
+    );
+    template <class Alloc>
+    constexpr object_pack(
+        std::allocator_arg_t,
+        const Alloc&,
+        const object_pack&
+    );
+    template <class Alloc>
+    constexpr object_pack(std::allocator_arg_t, const Alloc&, object_pack&&);
+
+    // Assignment
+    public:
+    template <class Operation, class... Operands>
+    constexpr object_pack& operator=(
+        const pack_expression<Operation, Operands...>&
+    );
 
     // Size
     public:
     static constexpr size_type size() noexcept;
+
+    // Implementation details: assignment
+    private:
+    template <class Expression, std::size_t... Indices>
+    constexpr void _assign(const Expression&, pack_index_sequence<Indices...>);
 };
 /* ************************************************************************** */
 
 
 
+/* **************************** OBJECT PACK: GET **************************** */
+// Object pack get overload set declaration
+template <std::size_t Index, class... Types>
+constexpr std::tuple_element_t<Index, object_pack<Types...>>& get(
+    object_pack<Types...>&
+) noexcept;
+template <std::size_t Index, class... Types>
+constexpr const std::tuple_element_t<Index, object_pack<Types...>>& get(
+    const object_pack<Types...>&
+) noexcept;
+template <std::size_t Index, class... Types>
+constexpr std::tuple_element_t<Index, object_pack<Types...>>&& get(
+    object_pack<Types...>&&
+) noexcept;
+template <std::size_t Index, class... Types>
+constexpr const std::tuple_element_t<Index, object_pack<Types...>>&& get(
+    const object_pack<Types...>&&
+) noexcept;
+/* ************************************************************************** */
+
+
+
+/* ************************ MAKE UNINITIALIZED ARRAY ************************ */
+// Uninitialized array maker declaration
+template <class Type>
+std::unique_ptr<Type[]> make_uninitialized_array(std::size_t);
+/* ************************************************************************** */
+
+
+
+/* **************************** RELOCATING SWAP ***************************** */
+// Relocating swap declaration
+template <class Type>
+constexpr void relocating_swap(Type&, Type&) noexcept(
+    is_trivially_relocatable_v<Type> || std::is_nothrow_swappable_v<Type>
+);
+/* ************************************************************************** */
+
+
+
 // --------------------- OBJECT PACK ELEMENT: LIFECYCLE --------------------- //
-// Constructs an empty object pack through value initialization
+// Explicitly constructs an object pack element through default initialization
 template <class Type, class Index, class Key>
 constexpr object_pack_element<Type, Index, Key>::object_pack_element(
-)
-: _object()
+    uninitialized_t
+) noexcept(_is_nothrow_default_constructible_v)
 {
 }
 
@@ -129,17 +508,27 @@ constexpr object_pack_element<Type, Index, Key>::object_pack_element(
 template <class Type, class Index, class Key>
 constexpr object_pack_element<Type, Index, Key>::object_pack_element(
     const type& object
-)
+) noexcept(_is_nothrow_copy_constructible_v)
 : _object(object)
 {
 }
 
+// Explicitly constructs an object pack element by forwarding an argument
+template <class Type, class Index, class Key>
+template <class Arg, class>
+constexpr object_pack_element<Type, Index, Key>::object_pack_element(
+    Arg&& arg
+) noexcept(_is_nothrow_constructible_from_v<Arg&&>)
+: _object(std::forward<Arg>(arg))
+{
+}
+
 // Explicitly constructs an object pack element from an object and index
 template <class Type, class Index, class Key>
 constexpr object_pack_element<Type, Index, Key>::object_pack_element(
     const type& object,
     index_type
-)
+) noexcept(_is_nothrow_copy_constructible_v)
 : _object(object)
 {
 }
@@ -150,10 +539,57 @@ constexpr object_pack_element<Type, Index, Key>::object_pack_element(
     const type& object,
     index_type,
     const key_type&
-)
+) noexcept(_is_nothrow_copy_constructible_v)
 : _object(object)
 {
 }
+
+// Constructs an object pack element using an allocator
+template <class Type, class Index, class Key>
+template <class Alloc>
+constexpr object_pack_element<Type, Index, Key>::object_pack_element(
+    std::allocator_arg_t,
+    const Alloc& alloc
+)
+: _object(_make_using_allocator(alloc))
+{
+}
+
+// Explicitly constructs an object pack element from an object and allocator
+template <class Type, class Index, class Key>
+template <class Alloc>
+constexpr object_pack_element<Type, Index, Key>::object_pack_element(
+    std::allocator_arg_t,
+    const Alloc& alloc,
+    const type& object
+)
+: _object(_make_using_allocator(alloc, object))
+{
+}
+
+// Copy constructs an object pack element using an allocator
+template <class Type, class Index, class Key>
+template <class Alloc>
+constexpr object_pack_element<Type, Index, Key>::object_pack_element(
+    std::allocator_arg_t,
+    const Alloc& alloc,
+    const object_pack_element& other
+)
+: _object(_make_using_allocator(alloc, other._object))
+{
+}
+
+// Move constructs an object pack element using an allocator
+template <class Type, class Index, class Key>
+template <class Alloc>
+constexpr object_pack_element<Type, Index, Key>::object_pack_element(
+    std::allocator_arg_t,
+    const Alloc& alloc,
+    object_pack_element&& other
+)
+: _object(_make_using_allocator(alloc, std::move(other._object)))
+{
+}
 // -------------------------------------------------------------------------- //
 
 
@@ -202,29 +638,344 @@ object_pack_element<Type, Index, Key>::operator[](
 
 
 
+// ----------------------- OBJECT PACK ELEMENT: VALUE ----------------------- //
+// Returns a reference to the object
+template <class Type, class Index, class Key>
+constexpr typename object_pack_element<Type, Index, Key>::type&
+object_pack_element<Type, Index, Key>::value(
+) & noexcept
+{
+    return _object;
+}
+
+// Returns an immutable reference to the object
+template <class Type, class Index, class Key>
+constexpr const typename object_pack_element<Type, Index, Key>::type&
+object_pack_element<Type, Index, Key>::value(
+) const& noexcept
+{
+    return _object;
+}
+
+// Returns an rvalue reference to the object
+template <class Type, class Index, class Key>
+constexpr typename object_pack_element<Type, Index, Key>::type&&
+object_pack_element<Type, Index, Key>::value(
+) && noexcept
+{
+    return std::move(_object);
+}
+
+// Returns an immutable rvalue reference to the object
+template <class Type, class Index, class Key>
+constexpr const typename object_pack_element<Type, Index, Key>::type&&
+object_pack_element<Type, Index, Key>::value(
+) const&& noexcept
+{
+    return std::move(_object);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------- OBJECT PACK ELEMENT: IMPLEMENTATION DETAILS --------------- //
+// Makes an object following the uses-allocator construction protocol
+template <class Type, class Index, class Key>
+template <class Alloc, class... Args>
+constexpr typename object_pack_element<Type, Index, Key>::type
+object_pack_element<Type, Index, Key>::_make_using_allocator(
+    const Alloc& alloc,
+    Args&&... args
+)
+{
+    if constexpr (!std::uses_allocator_v<type, Alloc>) {
+        return type(std::forward<Args>(args)...);
+    } else if constexpr (std::is_constructible_v<
+        type, std::allocator_arg_t, const Alloc&, Args&&...
+    >) {
+        return type(std::allocator_arg, alloc, std::forward<Args>(args)...);
+    } else {
+        return type(std::forward<Args>(args)..., alloc);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ----------------------- OBJECT PACK BASE: LIFECYCLE ---------------------- //
+// Explicitly constructs an object pack base through default initialization
+template <std::size_t... Indices, class... Types>
+constexpr
+object_pack_base<pack_index_sequence<Indices...>, Types...>::object_pack_base(
+    uninitialized_t tag
+) noexcept(_is_nothrow_default_constructible_v)
+: object_pack_element<Types, pack_index<Indices>>(tag)...
+{
+}
+
 // Explicitly constructs an object pack base from objects
 template <std::size_t... Indices, class... Types>
 constexpr
 object_pack_base<pack_index_sequence<Indices...>, Types...>::object_pack_base(
     const Types&... objects
-)
+) noexcept(_is_nothrow_copy_constructible_v)
 : object_pack_element<Types, pack_index<Indices>>(objects)...
 {
 }
+
+// Explicitly constructs an object pack base by forwarding arguments
+template <std::size_t... Indices, class... Types>
+template <class... Args, class>
+constexpr
+object_pack_base<pack_index_sequence<Indices...>, Types...>::object_pack_base(
+    Args&&... args
+) noexcept(_is_nothrow_constructible_from_v<Args&&...>)
+: object_pack_element<Types, pack_index<Indices>>(std::forward<Args>(args))...
+{
+}
+
+// Constructs an object pack base using an allocator
+template <std::size_t... Indices, class... Types>
+template <class Alloc>
+constexpr
+object_pack_base<pack_index_sequence<Indices...>, Types...>::object_pack_base(
+    std::allocator_arg_t tag,
+    const Alloc& alloc
+)
+: object_pack_element<Types, pack_index<Indices>>(tag, alloc)...
+{
+}
+
+// Explicitly constructs an object pack base from objects and an allocator
+template <std::size_t... Indices, class... Types>
+template <class Alloc>
+constexpr
+object_pack_base<pack_index_sequence<Indices...>, Types...>::object_pack_base(
+    std::allocator_arg_t tag,
+    const Alloc& alloc,
+    const Types&... objects
+)
+: object_pack_element<Types, pack_index<Indices>>(tag, alloc, objects)...
+{
+}
+
+// Copy constructs an object pack base using an allocator
+template <std::size_t... Indices, class... Types>
+template <class Alloc>
+constexpr
+object_pack_base<pack_index_sequence<Indices...>, Types...>::object_pack_base(
+    std::allocator_arg_t tag,
+    const Alloc& alloc,
+    const object_pack_base& other
+)
+: object_pack_element<Types, pack_index<Indices>>(
+    tag,
+    alloc,
+    static_cast<const object_pack_element<Types, pack_index<Indices>>&>(other)
+)...
+{
+}
+
+// Move constructs an object pack base using an allocator
+template <std::size_t... Indices, class... Types>
+template <class Alloc>
+constexpr
+object_pack_base<pack_index_sequence<Indices...>, Types...>::object_pack_base(
+    std::allocator_arg_t tag,
+    const Alloc& alloc,
+    object_pack_base&& other
+)
+: object_pack_element<Types, pack_index<Indices>>(
+    tag,
+    alloc,
+    static_cast<object_pack_element<Types, pack_index<Indices>>&&>(other)
+)...
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ OBJECT PACK BASE: ACCESS ------------------------ //
+// Returns the object pack element corresponding to the index
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index>
+constexpr auto&
+object_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    pack_index<Index>
+) noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Immutably returns the object pack element corresponding to the index
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index>
+constexpr const auto&
+object_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    pack_index<Index>
+) const noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Returns the object pack element corresponding to the key
+template <std::size_t... Indices, class... Types>
+template <class Key>
+constexpr auto&
+object_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    Key&&
+) noexcept
+{
+    return _at<decltype(_find<Key>(this))::value>(*this);
+}
+
+// Immutably returns the object pack element corresponding to the key
+template <std::size_t... Indices, class... Types>
+template <class Key>
+constexpr const auto&
+object_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    Key&&
+) const noexcept
+{
+    return _at<decltype(_find<Key>(this))::value>(*this);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------- OBJECT PACK BASE: IMPLEMENTATION DETAILS ---------------- //
+// Returns the element at the index, the only base that can be deduced
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index, class Type, class Key>
+constexpr auto&
+object_pack_base<pack_index_sequence<Indices...>, Types...>::_at(
+    object_pack_element<Type, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
+
+// Immutably returns the element at the index
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index, class Type, class Key>
+constexpr const auto&
+object_pack_base<pack_index_sequence<Indices...>, Types...>::_at(
+    const object_pack_element<Type, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
 // -------------------------------------------------------------------------- //
 
 
 
 // ------------------------- OBJECT PACK: LIFECYCLE ------------------------- //
+// Explicitly constructs an object pack through default initialization
+template <class... Types>
+constexpr object_pack<Types...>::object_pack(
+    uninitialized_t tag
+) noexcept(_is_nothrow_default_constructible_v)
+: base(tag)
+{
+}
+
 // Explicitly constructs an object pack from objects
 template <class... Types>
 constexpr object_pack<Types...>::object_pack(
     const Types&... objects
-)
+) noexcept(_is_nothrow_copy_constructible_v)
 : base(objects...)
 {
 }
+
+// Explicitly constructs an object pack by forwarding arguments
+template <class... Types>
+template <class... Args, class>
+constexpr object_pack<Types...>::object_pack(
+    Args&&... args
+) noexcept(_is_nothrow_constructible_from_v<Args&&...>)
+: base(std::forward<Args>(args)...)
+{
+}
+
+// Constructs an object pack using an allocator
+template <class... Types>
+template <class Alloc>
+constexpr object_pack<Types...>::object_pack(
+    std::allocator_arg_t tag,
+    const Alloc& alloc
+)
+: base(tag, alloc)
+{
+}
+
+// Explicitly constructs an object pack from objects and an allocator
+template <class... Types>
+template <class Alloc>
+constexpr object_pack<Types...>::object_pack(
+    std::allocator_arg_t tag,
+    const Alloc& alloc,
+    const Types&... objects
+)
+: base(tag, alloc, objects...)
+{
+}
+
+// Copy constructs an object pack using an allocator
+template <class... Types>
+template <class Alloc>
+constexpr object_pack<Types...>::object_pack(
+    std::allocator_arg_t tag,
+    const Alloc& alloc,
+    const object_pack& other
+)
+: base(tag, alloc, static_cast<const base&>(other))
+{
+}
+
+// Move constructs an object pack using an allocator
+template <class... Types>
+template <class Alloc>
+constexpr object_pack<Types...>::object_pack(
+    std::allocator_arg_t tag,
+    const Alloc& alloc,
+    object_pack&& other
+)
+: base(tag, alloc, static_cast<base&&>(other))
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ OBJECT PACK: ASSIGNMENT ------------------------- //
+// Evaluates an elementwise expression once into the pack
+template <class... Types>
+template <class Operation, class... Operands>
+constexpr object_pack<Types...>& object_pack<Types...>::operator=(
+    const pack_expression<Operation, Operands...>& expression
+)
+{
+    using expression_type = pack_expression<Operation, Operands...>;
+    static_assert(expression_type::size() == size(), "mismatching sizes");
+    _assign(expression, index_sequence{});
+    return *this;
+}
+
+// Computes all the elements before storing them, so that aliasing is safe
+template <class... Types>
+template <class Expression, std::size_t... Indices>
+constexpr void object_pack<Types...>::_assign(
+    const Expression& expression,
+    pack_index_sequence<Indices...>
+)
+{
+    object_pack<std::decay_t<decltype(get<Indices>(expression))>...> values(
+        get<Indices>(expression)...
+    );
+    ((get<Indices>(*this) = std::move(get<Indices>(values))), ...);
+}
 // -------------------------------------------------------------------------- //
 
 
@@ -242,8 +993,135 @@ object_pack<Types...>::size(
 
 
 
+// ---------------------------- OBJECT PACK: GET ---------------------------- //
+// Returns a reference to the object at the given index
+template <std::size_t Index, class... Types>
+constexpr std::tuple_element_t<Index, object_pack<Types...>>& get(
+    object_pack<Types...>& pack
+) noexcept
+{
+    return pack[pack_index_v<Index>].value();
+}
+
+// Returns an immutable reference to the object at the given index
+template <std::size_t Index, class... Types>
+constexpr const std::tuple_element_t<Index, object_pack<Types...>>& get(
+    const object_pack<Types...>& pack
+) noexcept
+{
+    return pack[pack_index_v<Index>].value();
+}
+
+// Returns an rvalue reference to the object at the given index
+template <std::size_t Index, class... Types>
+constexpr std::tuple_element_t<Index, object_pack<Types...>>&& get(
+    object_pack<Types...>&& pack
+) noexcept
+{
+    return std::move(pack[pack_index_v<Index>]).value();
+}
+
+// Returns an immutable rvalue reference to the object at the given index
+template <std::size_t Index, class... Types>
+constexpr const std::tuple_element_t<Index, object_pack<Types...>>&& get(
+    const object_pack<Types...>&& pack
+) noexcept
+{
+    return std::move(pack[pack_index_v<Index>]).value();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ MAKE UNINITIALIZED ARRAY ------------------------ //
+// Allocates an array of default initialized objects meant to be overwritten
+template <class Type>
+std::unique_ptr<Type[]> make_uninitialized_array(
+    std::size_t size
+)
+{
+    return std::unique_ptr<Type[]>(new Type[size]);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- RELOCATING SWAP ----------------------------- //
+// Swaps two objects: the ones that opted in trivial relocation without being
+// trivially copyable are swapped as bytes, bypassing their move constructors,
+// move assignments and destructors, and the others through an adl swap
+template <class Type>
+constexpr void relocating_swap(
+    Type& lhs,
+    Type& rhs
+) noexcept(
+    is_trivially_relocatable_v<Type> || std::is_nothrow_swappable_v<Type>
+)
+{
+    if constexpr (
+        is_trivially_relocatable_v<Type> && !std::is_trivially_copyable_v<Type>
+    ) {
+        if (std::addressof(lhs) != std::addressof(rhs)) {
+            alignas(Type) unsigned char buffer[sizeof(Type)];
+            void* left = static_cast<void*>(std::addressof(lhs));
+            void* right = static_cast<void*>(std::addressof(rhs));
+            std::memcpy(buffer, left, sizeof(Type));
+            std::memcpy(left, right, sizeof(Type));
+            std::memcpy(right, buffer, sizeof(Type));
+        }
+    } else {
+        using std::swap;
+        swap(lhs, rhs);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ========================================================================== //
 } // namespace pck
+namespace std {
+// ========================================================================== //
+
+
+
+/* ************************ TUPLE SIZE: OBJECT PACK ************************* */
+// Tuple size specialization for object packs
+template <class... Types>
+struct tuple_size<pck::object_pack<Types...>>
+: integral_constant<size_t, sizeof...(Types)>
+{
+};
+/* ************************************************************************** */
+
+
+
+/* *********************** TUPLE ELEMENT: OBJECT PACK *********************** */
+// Tuple element specialization for object packs
+template <size_t Index, class... Types>
+struct tuple_element<Index, pck::object_pack<Types...>>
+{
+    using type = typename remove_reference_t<decltype(
+        declval<pck::object_pack<Types...>&>()[pck::pack_index_v<Index>]
+    )>::type;
+};
+/* ************************************************************************** */
+
+
+
+/* ********************** USES ALLOCATOR: OBJECT PACK *********************** */
+// Uses allocator specialization: object packs accept any allocator
+template <class... Types, class Alloc>
+struct uses_allocator<pck::object_pack<Types...>, Alloc>
+: true_type
+{
+};
+/* ************************************************************************** */
+
+
+
+// ========================================================================== //
+} // namespace std
 #endif // _OBJECT_PACK_HPP_INCLUDED
 // ========================================================================== //
 
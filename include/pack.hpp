@@ -25,6 +25,28 @@
 #include "mixed_template_pack.hpp"
 #include "object_pack.hpp"
 #include "reference_pack.hpp"
+#include "pack_aggregate.hpp"
+#include "pack_tuple.hpp"
+#include "pack_gather.hpp"
+#include "pack_cat.hpp"
+#include "zip_view.hpp"
+#include "zip_sort.hpp"
+#include "pack_pipe.hpp"
+#include "pack_algorithm.hpp"
+#include "pack_expression.hpp"
+#include "pack_batch.hpp"
+#include "spsc_queue.hpp"
+#include "pack_pipeline.hpp"
+#include "task_graph.hpp"
+#include "pack_coroutine.hpp"
+#include "message_queue.hpp"
+#include "pack_pool.hpp"
+#include "atomic_pack.hpp"
+#include "seqlock_pack.hpp"
+#include "padded_object_pack.hpp"
+#include "sharded_pack.hpp"
+#include "bitfield_pack.hpp"
+#include "type_registry.hpp"
 // Third-party libraries
 // Miscellaneous
 namespace pck {
@@ -105,7 +127,9 @@ constexpr reference_pack<References&&...> pack(
     References&&... references
 )
 {
-    return {std::forward<References>(references)...};
+    return reference_pack<References&&...>(
+        std::forward<References>(references)...
+    );
 }
 // -------------------------------------------------------------------------- //
 
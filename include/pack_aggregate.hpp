@@ -0,0 +1,1668 @@
+// ============================= PACK AGGREGATE ============================= //
+// Project:         Pack
+// Name:            pack_aggregate.hpp
+// Description:     Decomposition of aggregates into their fields
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_AGGREGATE_HPP_INCLUDED
+#define _PACK_AGGREGATE_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ***************************** AGGREGATE SIZE ***************************** */
+// Maximum number of fields of the aggregates that can be decomposed
+inline constexpr std::size_t aggregate_size_limit = 64;
+
+// Aggregate field structure definition: converts to a reference to anything,
+// to count the initializers of an aggregate in unevaluated contexts only, the
+// rvalue conversion initializing move-only fields and the lvalue one references
+struct aggregate_field
+{
+    template <class Type>
+    constexpr operator Type&() const& noexcept;
+    template <class Type>
+    constexpr operator Type&&() const&& noexcept;
+};
+
+// Is aggregate initializable structure definition: false by default
+template <class Type, class Indices, class = void>
+struct is_aggregate_initializable
+: std::false_type
+{
+};
+
+// Is aggregate initializable structure specialization: true when the type
+// can be initialized from as many fields as indices
+template <class Type, std::size_t... Indices>
+struct is_aggregate_initializable<
+    Type,
+    pack_index_sequence<Indices...>,
+    std::void_t<decltype(Type{
+        (static_cast<void>(Indices), aggregate_field{})...
+    })>
+>
+: std::true_type
+{
+};
+
+// Aggregate size structure declaration
+template <
+    class Type,
+    class = make_pack_index_sequence<aggregate_size_limit + 2>
+>
+struct aggregate_size;
+
+// Aggregate size structure specialization: the largest number of initializers
+// accepted by the aggregate, probed up to one more than the limit, which is
+// its number of fields as long as none of them is a C array or a base class,
+// whose elements brace elision would count separately
+template <class Type, std::size_t... Sizes>
+struct aggregate_size<Type, pack_index_sequence<Sizes...>>
+: std::integral_constant<std::size_t, std::max({(
+    is_aggregate_initializable<
+        Type,
+        make_pack_index_sequence<Sizes>
+    >::value ? Sizes : 0
+)...})>
+{
+};
+
+// Variable template
+template <class Type>
+inline constexpr std::size_t aggregate_size_v = aggregate_size<Type>::value;
+/* ************************************************************************** */
+
+
+
+/* **************************** AGGREGATE APPLY ***************************** */
+// Aggregate apply declaration
+template <class Function, class Aggregate>
+constexpr decltype(auto) aggregate_apply(Function&&, Aggregate&&);
+/* ************************************************************************** */
+
+
+
+// ---------------------------- AGGREGATE APPLY ----------------------------- //
+// Invokes a function on the fields of an aggregate, bound through structured
+// bindings: the fields of an rvalue aggregate are forwarded with their declared
+// types, so that its objects are passed as rvalues and its references as is
+template <class Function, class Aggregate>
+constexpr decltype(auto) aggregate_apply(
+    Function&& function,
+    Aggregate&& aggregate
+)
+{
+    using type = std::remove_cv_t<std::remove_reference_t<Aggregate>>;
+    static_assert(std::is_aggregate_v<type>, "the type should be an aggregate");
+    constexpr std::size_t size = aggregate_size_v<type>;
+    static_assert(size <= aggregate_size_limit, "the aggregate is too large");
+    auto invoke = [&function](auto&&... fields) -> decltype(auto) {
+        if constexpr (std::is_lvalue_reference_v<Aggregate>) {
+            return std::invoke(std::forward<Function>(function), fields...);
+        } else {
+            return std::invoke(
+                std::forward<Function>(function),
+                std::forward<decltype(fields)>(fields)...
+            );
+        }
+    };
+    if constexpr (size == 0) {
+        return invoke();
+    } else if constexpr (size == 1) {
+        auto& [x0] = aggregate;
+        return invoke(std::forward<decltype(x0)>(x0));
+    } else if constexpr (size == 2) {
+        auto& [x0, x1] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1)
+        );
+    } else if constexpr (size == 3) {
+        auto& [x0, x1, x2] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2)
+        );
+    } else if constexpr (size == 4) {
+        auto& [x0, x1, x2, x3] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3)
+        );
+    } else if constexpr (size == 5) {
+        auto& [x0, x1, x2, x3, x4] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4)
+        );
+    } else if constexpr (size == 6) {
+        auto& [x0, x1, x2, x3, x4, x5] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5)
+        );
+    } else if constexpr (size == 7) {
+        auto& [x0, x1, x2, x3, x4, x5, x6] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6)
+        );
+    } else if constexpr (size == 8) {
+        auto& [x0, x1, x2, x3, x4, x5, x6, x7] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7)
+        );
+    } else if constexpr (size == 9) {
+        auto& [x0, x1, x2, x3, x4, x5, x6, x7, x8] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8)
+        );
+    } else if constexpr (size == 10) {
+        auto& [x0, x1, x2, x3, x4, x5, x6, x7, x8, x9] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9)
+        );
+    } else if constexpr (size == 11) {
+        auto& [x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10)
+        );
+    } else if constexpr (size == 12) {
+        auto& [x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11)
+        );
+    } else if constexpr (size == 13) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12)
+        );
+    } else if constexpr (size == 14) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13)
+        );
+    } else if constexpr (size == 15) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14)
+        );
+    } else if constexpr (size == 16) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15)
+        );
+    } else if constexpr (size == 17) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16)
+        );
+    } else if constexpr (size == 18) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17)
+        );
+    } else if constexpr (size == 19) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18)
+        );
+    } else if constexpr (size == 20) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19)
+        );
+    } else if constexpr (size == 21) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20)
+        );
+    } else if constexpr (size == 22) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21)
+        );
+    } else if constexpr (size == 23) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22)
+        );
+    } else if constexpr (size == 24) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23)
+        );
+    } else if constexpr (size == 25) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24)
+        );
+    } else if constexpr (size == 26) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25)
+        );
+    } else if constexpr (size == 27) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26)
+        );
+    } else if constexpr (size == 28) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27)
+        );
+    } else if constexpr (size == 29) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28)
+        );
+    } else if constexpr (size == 30) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29)
+        );
+    } else if constexpr (size == 31) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30)
+        );
+    } else if constexpr (size == 32) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31)
+        );
+    } else if constexpr (size == 33) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32)
+        );
+    } else if constexpr (size == 34) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33)
+        );
+    } else if constexpr (size == 35) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34)
+        );
+    } else if constexpr (size == 36) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35)
+        );
+    } else if constexpr (size == 37) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36)
+        );
+    } else if constexpr (size == 38) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37)
+        );
+    } else if constexpr (size == 39) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38)
+        );
+    } else if constexpr (size == 40) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39)
+        );
+    } else if constexpr (size == 41) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40)
+        );
+    } else if constexpr (size == 42) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41)
+        );
+    } else if constexpr (size == 43) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42)
+        );
+    } else if constexpr (size == 44) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43)
+        );
+    } else if constexpr (size == 45) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44)
+        );
+    } else if constexpr (size == 46) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45)
+        );
+    } else if constexpr (size == 47) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46)
+        );
+    } else if constexpr (size == 48) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47)
+        );
+    } else if constexpr (size == 49) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48)
+        );
+    } else if constexpr (size == 50) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49)
+        );
+    } else if constexpr (size == 51) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50)
+        );
+    } else if constexpr (size == 52) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51)
+        );
+    } else if constexpr (size == 53) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52)
+        );
+    } else if constexpr (size == 54) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53)
+        );
+    } else if constexpr (size == 55) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53),
+            std::forward<decltype(x54)>(x54)
+        );
+    } else if constexpr (size == 56) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53,
+            x54, x55
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53),
+            std::forward<decltype(x54)>(x54), std::forward<decltype(x55)>(x55)
+        );
+    } else if constexpr (size == 57) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53,
+            x54, x55, x56
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53),
+            std::forward<decltype(x54)>(x54), std::forward<decltype(x55)>(x55),
+            std::forward<decltype(x56)>(x56)
+        );
+    } else if constexpr (size == 58) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53,
+            x54, x55, x56, x57
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53),
+            std::forward<decltype(x54)>(x54), std::forward<decltype(x55)>(x55),
+            std::forward<decltype(x56)>(x56), std::forward<decltype(x57)>(x57)
+        );
+    } else if constexpr (size == 59) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53,
+            x54, x55, x56, x57, x58
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53),
+            std::forward<decltype(x54)>(x54), std::forward<decltype(x55)>(x55),
+            std::forward<decltype(x56)>(x56), std::forward<decltype(x57)>(x57),
+            std::forward<decltype(x58)>(x58)
+        );
+    } else if constexpr (size == 60) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53,
+            x54, x55, x56, x57, x58, x59
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53),
+            std::forward<decltype(x54)>(x54), std::forward<decltype(x55)>(x55),
+            std::forward<decltype(x56)>(x56), std::forward<decltype(x57)>(x57),
+            std::forward<decltype(x58)>(x58), std::forward<decltype(x59)>(x59)
+        );
+    } else if constexpr (size == 61) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53,
+            x54, x55, x56, x57, x58, x59, x60
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53),
+            std::forward<decltype(x54)>(x54), std::forward<decltype(x55)>(x55),
+            std::forward<decltype(x56)>(x56), std::forward<decltype(x57)>(x57),
+            std::forward<decltype(x58)>(x58), std::forward<decltype(x59)>(x59),
+            std::forward<decltype(x60)>(x60)
+        );
+    } else if constexpr (size == 62) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53,
+            x54, x55, x56, x57, x58, x59, x60, x61
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53),
+            std::forward<decltype(x54)>(x54), std::forward<decltype(x55)>(x55),
+            std::forward<decltype(x56)>(x56), std::forward<decltype(x57)>(x57),
+            std::forward<decltype(x58)>(x58), std::forward<decltype(x59)>(x59),
+            std::forward<decltype(x60)>(x60), std::forward<decltype(x61)>(x61)
+        );
+    } else if constexpr (size == 63) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53,
+            x54, x55, x56, x57, x58, x59, x60, x61, x62
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53),
+            std::forward<decltype(x54)>(x54), std::forward<decltype(x55)>(x55),
+            std::forward<decltype(x56)>(x56), std::forward<decltype(x57)>(x57),
+            std::forward<decltype(x58)>(x58), std::forward<decltype(x59)>(x59),
+            std::forward<decltype(x60)>(x60), std::forward<decltype(x61)>(x61),
+            std::forward<decltype(x62)>(x62)
+        );
+    } else if constexpr (size == 64) {
+        auto& [
+            x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14,
+            x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27,
+            x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40,
+            x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53,
+            x54, x55, x56, x57, x58, x59, x60, x61, x62, x63
+        ] = aggregate;
+        return invoke(
+            std::forward<decltype(x0)>(x0), std::forward<decltype(x1)>(x1),
+            std::forward<decltype(x2)>(x2), std::forward<decltype(x3)>(x3),
+            std::forward<decltype(x4)>(x4), std::forward<decltype(x5)>(x5),
+            std::forward<decltype(x6)>(x6), std::forward<decltype(x7)>(x7),
+            std::forward<decltype(x8)>(x8), std::forward<decltype(x9)>(x9),
+            std::forward<decltype(x10)>(x10), std::forward<decltype(x11)>(x11),
+            std::forward<decltype(x12)>(x12), std::forward<decltype(x13)>(x13),
+            std::forward<decltype(x14)>(x14), std::forward<decltype(x15)>(x15),
+            std::forward<decltype(x16)>(x16), std::forward<decltype(x17)>(x17),
+            std::forward<decltype(x18)>(x18), std::forward<decltype(x19)>(x19),
+            std::forward<decltype(x20)>(x20), std::forward<decltype(x21)>(x21),
+            std::forward<decltype(x22)>(x22), std::forward<decltype(x23)>(x23),
+            std::forward<decltype(x24)>(x24), std::forward<decltype(x25)>(x25),
+            std::forward<decltype(x26)>(x26), std::forward<decltype(x27)>(x27),
+            std::forward<decltype(x28)>(x28), std::forward<decltype(x29)>(x29),
+            std::forward<decltype(x30)>(x30), std::forward<decltype(x31)>(x31),
+            std::forward<decltype(x32)>(x32), std::forward<decltype(x33)>(x33),
+            std::forward<decltype(x34)>(x34), std::forward<decltype(x35)>(x35),
+            std::forward<decltype(x36)>(x36), std::forward<decltype(x37)>(x37),
+            std::forward<decltype(x38)>(x38), std::forward<decltype(x39)>(x39),
+            std::forward<decltype(x40)>(x40), std::forward<decltype(x41)>(x41),
+            std::forward<decltype(x42)>(x42), std::forward<decltype(x43)>(x43),
+            std::forward<decltype(x44)>(x44), std::forward<decltype(x45)>(x45),
+            std::forward<decltype(x46)>(x46), std::forward<decltype(x47)>(x47),
+            std::forward<decltype(x48)>(x48), std::forward<decltype(x49)>(x49),
+            std::forward<decltype(x50)>(x50), std::forward<decltype(x51)>(x51),
+            std::forward<decltype(x52)>(x52), std::forward<decltype(x53)>(x53),
+            std::forward<decltype(x54)>(x54), std::forward<decltype(x55)>(x55),
+            std::forward<decltype(x56)>(x56), std::forward<decltype(x57)>(x57),
+            std::forward<decltype(x58)>(x58), std::forward<decltype(x59)>(x59),
+            std::forward<decltype(x60)>(x60), std::forward<decltype(x61)>(x61),
+            std::forward<decltype(x62)>(x62), std::forward<decltype(x63)>(x63)
+        );
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _PACK_AGGREGATE_HPP_INCLUDED
+// ========================================================================== //
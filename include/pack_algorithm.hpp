@@ -0,0 +1,426 @@
+// ============================= PACK ALGORITHM ============================= //
+// Project:         Pack
+// Name:            pack_algorithm.hpp
+// Description:     Value-based algorithms on type packs
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_ALGORITHM_HPP_INCLUDED
+#define _PACK_ALGORITHM_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "empty_pack.hpp"
+#include "type_pack.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ******************************** TYPE ID ********************************* */
+// Type id class definition: a type as a value
+template <class Type>
+class type_id
+{
+    // Types
+    public:
+    using type = Type;
+
+    // Lifecycle
+    public:
+    constexpr type_id() noexcept = default;
+};
+
+// Variable template
+template <class Type>
+inline constexpr type_id<Type> type_id_v = {};
+
+// Type id comparison operators declaration
+template <class Lhs, class Rhs>
+constexpr bool operator==(type_id<Lhs>, type_id<Rhs>) noexcept;
+template <class Lhs, class Rhs>
+constexpr bool operator!=(type_id<Lhs>, type_id<Rhs>) noexcept;
+/* ************************************************************************** */
+
+
+
+/* ***************************** PACK SELECTION ***************************** */
+// Pack selection class definition: the indices where the mask is true
+template <bool... Mask>
+class pack_selection
+{
+    // Implementation details: indices
+    private:
+    struct _indices_type {
+        std::array<std::size_t, sizeof...(Mask)> values;
+        std::size_t size;
+    };
+    static constexpr _indices_type _make_indices() noexcept;
+    static constexpr _indices_type _indices = _make_indices();
+    template <std::size_t... Indices>
+    static constexpr auto _type(pack_index_sequence<Indices...>)
+    -> pack_index_sequence<_indices.values[Indices]...>;
+
+    // Types
+    public:
+    using type = decltype(_type(make_pack_index_sequence<_indices.size>{}));
+};
+/* ************************************************************************** */
+
+
+
+/* ***************************** TYPE ID TABLE ****************************** */
+// Type id table class definition: the identifiers of the types of a pack
+template <class... Types>
+class type_id_table
+{
+    // Search
+    public:
+    static constexpr std::size_t find(const void*) noexcept;
+    static constexpr bool is_first(std::size_t) noexcept;
+
+    // Implementation details: identifiers
+    private:
+    static constexpr std::array<const void*, sizeof...(Types)> _ids = {
+        &type_tag<Types>...
+    };
+};
+/* ************************************************************************** */
+
+
+
+/* ************************** TYPE PACK ALGORITHM *************************** */
+// Type pack algorithm class definition: materialization of the results
+template <class... Types>
+class type_pack_algorithm
+{
+    // Implementation details: materialization
+    private:
+    using _table = type_id_table<Types...>;
+    static constexpr auto _select(pack_index_sequence<>) -> empty_pack;
+    template <std::size_t... Indices>
+    static constexpr auto _select(pack_index_sequence<Indices...>)
+    -> type_pack<pack_index_lookup_t<Indices, Types...>...>;
+
+    // Types
+    public:
+    template <bool... Mask>
+    using select_type = decltype(_select(
+        typename pack_selection<Mask...>::type{}
+    ));
+
+    // Materialization: unevaluated contexts only
+    public:
+    template <std::size_t... Indices>
+    static constexpr auto unique(pack_index_sequence<Indices...>)
+    -> select_type<_table::is_first(Indices)...>;
+};
+/* ************************************************************************** */
+
+
+
+/* ********************************* FILTER ********************************* */
+// Filter overload set declaration
+template <class Predicate>
+constexpr empty_pack filter(empty_pack, Predicate) noexcept;
+template <class... Types, class Predicate>
+constexpr auto filter(type_pack<Types...>, Predicate) noexcept;
+/* ************************************************************************** */
+
+
+
+/* ******************************* TRANSFORM ******************************** */
+// Transform overload set declaration
+template <class Function>
+constexpr empty_pack transform(empty_pack, Function) noexcept;
+template <class... Types, class Function>
+constexpr auto transform(type_pack<Types...>, Function) noexcept;
+/* ************************************************************************** */
+
+
+
+/* ********************************* UNIQUE ********************************* */
+// Unique overload set declaration
+constexpr empty_pack unique(empty_pack) noexcept;
+template <class... Types>
+constexpr auto unique(type_pack<Types...>) noexcept;
+/* ************************************************************************** */
+
+
+
+/* ********************************** FIND ********************************** */
+// Find overload set declaration
+template <class Type>
+constexpr std::size_t find(empty_pack, type_id<Type>) noexcept;
+template <class... Types, class Type>
+constexpr std::size_t find(type_pack<Types...>, type_id<Type>) noexcept;
+/* ************************************************************************** */
+
+
+
+/* ******************************** FIND IF ********************************* */
+// Find if overload set declaration
+template <class Predicate>
+constexpr std::size_t find_if(empty_pack, Predicate) noexcept;
+template <class... Types, class Predicate>
+constexpr std::size_t find_if(type_pack<Types...>, Predicate) noexcept;
+/* ************************************************************************** */
+
+
+
+/* ******************************** COUNT IF ******************************** */
+// Count if overload set declaration
+template <class Predicate>
+constexpr std::size_t count_if(empty_pack, Predicate) noexcept;
+template <class... Types, class Predicate>
+constexpr std::size_t count_if(type_pack<Types...>, Predicate) noexcept;
+/* ************************************************************************** */
+
+
+
+// -------------------------- TYPE ID: COMPARISON --------------------------- //
+// Checks whether two type identifiers refer to the same type
+template <class Lhs, class Rhs>
+constexpr bool operator==(
+    type_id<Lhs>,
+    type_id<Rhs>
+) noexcept
+{
+    return &type_tag<Lhs> == &type_tag<Rhs>;
+}
+
+// Checks whether two type identifiers refer to different types
+template <class Lhs, class Rhs>
+constexpr bool operator!=(
+    type_id<Lhs>,
+    type_id<Rhs>
+) noexcept
+{
+    return &type_tag<Lhs> != &type_tag<Rhs>;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------- PACK SELECTION: IMPLEMENTATION DETAILS ----------------- //
+// Computes the indices where the mask is true
+template <bool... Mask>
+constexpr typename pack_selection<Mask...>::_indices_type
+pack_selection<Mask...>::_make_indices(
+) noexcept
+{
+    constexpr std::array<bool, sizeof...(Mask)> mask = {Mask...};
+    _indices_type indices = {};
+    for (std::size_t i = 0; i < mask.size(); ++i) {
+        if (mask[i]) {
+            indices.values[indices.size++] = i;
+        }
+    }
+    return indices;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- TYPE ID TABLE: SEARCH -------------------------- //
+// Returns the index of the first type with the identifier, or the size
+template <class... Types>
+constexpr std::size_t type_id_table<Types...>::find(
+    const void* id
+) noexcept
+{
+    std::size_t i = 0;
+    while (i < _ids.size() && _ids[i] != id) {
+        ++i;
+    }
+    return i;
+}
+
+// Checks whether the type at the index does not appear before it
+template <class... Types>
+constexpr bool type_id_table<Types...>::is_first(
+    std::size_t index
+) noexcept
+{
+    return find(_ids[index]) == index;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------------- FILTER --------------------------------- //
+// Filters an empty pack
+template <class Predicate>
+constexpr empty_pack filter(
+    empty_pack,
+    Predicate
+) noexcept
+{
+    return {};
+}
+
+// Keeps the types whose identifiers satisfy a constexpr predicate
+template <class... Types, class Predicate>
+constexpr auto filter(
+    type_pack<Types...>,
+    Predicate predicate
+) noexcept
+{
+    using algorithm = type_pack_algorithm<Types...>;
+    return typename algorithm::template select_type<
+        bool(predicate(type_id<Types>{}))...
+    >{};
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------------- TRANSFORM -------------------------------- //
+// Transforms an empty pack
+template <class Function>
+constexpr empty_pack transform(
+    empty_pack,
+    Function
+) noexcept
+{
+    return {};
+}
+
+// Replaces the types by the type identifiers returned by a function
+template <class... Types, class Function>
+constexpr auto transform(
+    type_pack<Types...>,
+    Function function
+) noexcept
+{
+    return type_pack<
+        typename decltype(function(type_id<Types>{}))::type...
+    >{};
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------------- UNIQUE --------------------------------- //
+// Removes the duplicates of an empty pack
+constexpr empty_pack unique(
+    empty_pack
+) noexcept
+{
+    return {};
+}
+
+// Keeps the first occurrence of each type
+template <class... Types>
+constexpr auto unique(
+    type_pack<Types...>
+) noexcept
+{
+    using algorithm = type_pack_algorithm<Types...>;
+    return decltype(
+        algorithm::unique(make_pack_index_sequence<sizeof...(Types)>{})
+    ){};
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------- FIND ---------------------------------- //
+// Finds a type in an empty pack
+template <class Type>
+constexpr std::size_t find(
+    empty_pack,
+    type_id<Type>
+) noexcept
+{
+    return 0;
+}
+
+// Returns the index of the first occurrence of a type, or the size
+template <class... Types, class Type>
+constexpr std::size_t find(
+    type_pack<Types...>,
+    type_id<Type>
+) noexcept
+{
+    return type_id_table<Types...>::find(&type_tag<Type>);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------------- FIND IF --------------------------------- //
+// Finds a type satisfying a predicate in an empty pack
+template <class Predicate>
+constexpr std::size_t find_if(
+    empty_pack,
+    Predicate
+) noexcept
+{
+    return 0;
+}
+
+// Returns the index of the first type satisfying a predicate, or the size
+template <class... Types, class Predicate>
+constexpr std::size_t find_if(
+    type_pack<Types...>,
+    Predicate predicate
+) noexcept
+{
+    const std::array<bool, sizeof...(Types)> mask = {
+        bool(predicate(type_id<Types>{}))...
+    };
+    std::size_t i = 0;
+    while (i < mask.size() && !mask[i]) {
+        ++i;
+    }
+    return i;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------------- COUNT IF -------------------------------- //
+// Counts the types satisfying a predicate in an empty pack
+template <class Predicate>
+constexpr std::size_t count_if(
+    empty_pack,
+    Predicate
+) noexcept
+{
+    return 0;
+}
+
+// Returns the number of types satisfying a predicate
+template <class... Types, class Predicate>
+constexpr std::size_t count_if(
+    type_pack<Types...>,
+    Predicate predicate
+) noexcept
+{
+    const std::array<bool, sizeof...(Types)> mask = {
+        bool(predicate(type_id<Types>{}))...
+    };
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < mask.size(); ++i) {
+        count += mask[i];
+    }
+    return count;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _PACK_ALGORITHM_HPP_INCLUDED
+// ========================================================================== //
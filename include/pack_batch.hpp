@@ -0,0 +1,345 @@
+// =============================== PACK BATCH =============================== //
+// Project:         Pack
+// Name:            pack_batch.hpp
+// Description:     Fixed-size blocks of records stored as structures of arrays
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_BATCH_HPP_INCLUDED
+#define _PACK_BATCH_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <utility>
+#include <iterator>
+#include <type_traits>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "object_pack.hpp"
+#include "reference_pack.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ********************************* BATCH ********************************** */
+// Batch class definition: a block of rows stored as one array per column
+template <std::size_t Size, class... Types>
+class batch
+{
+    // Types
+    public:
+    using size_type = std::size_t;
+    using index_sequence = make_pack_index_sequence<sizeof...(Types)>;
+    using columns_type = object_pack<std::array<Types, Size>...>;
+    using value_type = object_pack<Types...>;
+    using reference = reference_pack<Types&...>;
+    using const_reference = reference_pack<const Types&...>;
+
+    // Lifecycle
+    public:
+    constexpr batch() = default;
+
+    // Access
+    public:
+    constexpr reference operator[](size_type);
+    constexpr const_reference operator[](size_type) const;
+    constexpr columns_type& columns() noexcept;
+    constexpr const columns_type& columns() const noexcept;
+
+    // Row transfer
+    public:
+    template <class Row>
+    constexpr void load(size_type, const Row&);
+    template <class Row>
+    constexpr void store(size_type, Row&&) const;
+
+    // Size
+    public:
+    static constexpr size_type size() noexcept;
+
+    // Implementation details: rows
+    private:
+    template <class Self, std::size_t... Indices>
+    static constexpr auto _row(
+        Self&,
+        size_type,
+        pack_index_sequence<Indices...>
+    );
+    template <class Row, std::size_t... Indices>
+    constexpr void _load(
+        size_type,
+        const Row&,
+        pack_index_sequence<Indices...>
+    );
+    template <class Row, std::size_t... Indices>
+    constexpr void _store(
+        size_type,
+        Row&,
+        pack_index_sequence<Indices...>
+    ) const;
+    template <class Element, class Type>
+    static constexpr void _assign(Element&&, const Type&);
+
+    // Implementation details: data members
+    private:
+    columns_type _columns;
+};
+/* ************************************************************************** */
+
+
+
+/* ******************************* BATCH: GET ******************************* */
+// Batch get overload set declaration: columns
+template <std::size_t Index, std::size_t Size, class... Types>
+constexpr auto& get(batch<Size, Types...>&) noexcept;
+template <std::size_t Index, std::size_t Size, class... Types>
+constexpr const auto& get(const batch<Size, Types...>&) noexcept;
+/* ************************************************************************** */
+
+
+
+/* ******************************* MAKE BATCH ******************************* */
+// Batch maker structure declaration
+template <
+    std::size_t Size,
+    class Row,
+    class = make_pack_index_sequence<std::tuple_size_v<Row>>
+>
+struct batch_maker;
+
+// Batch maker structure specialization: the batch of the rows of a range
+template <std::size_t Size, class Row, std::size_t... Indices>
+struct batch_maker<Size, Row, pack_index_sequence<Indices...>>
+{
+    using type = batch<
+        Size,
+        std::decay_t<std::tuple_element_t<Indices, Row>>...
+    >;
+};
+
+// Alias template maker
+template <std::size_t Size, class Row>
+using make_batch = typename batch_maker<Size, Row>::type;
+/* ************************************************************************** */
+
+
+
+/* ***************************** FOR EACH BATCH ***************************** */
+// For each batch declaration
+template <std::size_t Size, class Range, class Kernel>
+constexpr void for_each_batch(Range&&, Kernel&&);
+/* ************************************************************************** */
+
+
+
+// ----------------------------- BATCH: ACCESS ------------------------------ //
+// Returns a reference pack to the elements of a row
+template <std::size_t Size, class... Types>
+constexpr typename batch<Size, Types...>::reference
+batch<Size, Types...>::operator[](
+    size_type row
+)
+{
+    return _row(*this, row, index_sequence{});
+}
+
+// Returns an immutable reference pack to the elements of a row
+template <std::size_t Size, class... Types>
+constexpr typename batch<Size, Types...>::const_reference
+batch<Size, Types...>::operator[](
+    size_type row
+) const
+{
+    return _row(*this, row, index_sequence{});
+}
+
+// Returns the columns
+template <std::size_t Size, class... Types>
+constexpr typename batch<Size, Types...>::columns_type&
+batch<Size, Types...>::columns(
+) noexcept
+{
+    return _columns;
+}
+
+// Returns the columns as immutable
+template <std::size_t Size, class... Types>
+constexpr const typename batch<Size, Types...>::columns_type&
+batch<Size, Types...>::columns(
+) const noexcept
+{
+    return _columns;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- BATCH: ROW TRANSFER --------------------------- //
+// Copies the elements of a record into a row
+template <std::size_t Size, class... Types>
+template <class Row>
+constexpr void batch<Size, Types...>::load(
+    size_type row,
+    const Row& values
+)
+{
+    _load(row, values, index_sequence{});
+}
+
+// Copies the elements of a row back into the writable elements of a record or
+// of a reference pack, leaving the immutable ones untouched
+template <std::size_t Size, class... Types>
+template <class Row>
+constexpr void batch<Size, Types...>::store(
+    size_type row,
+    Row&& values
+) const
+{
+    _store(row, values, index_sequence{});
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------------ BATCH: SIZE ------------------------------- //
+// Returns the number of rows in the batch
+template <std::size_t Size, class... Types>
+constexpr typename batch<Size, Types...>::size_type
+batch<Size, Types...>::size(
+) noexcept
+{
+    return Size;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- BATCH: IMPLEMENTATION DETAILS ---------------------- //
+// Makes a reference pack to the elements of a row
+template <std::size_t Size, class... Types>
+template <class Self, std::size_t... Indices>
+constexpr auto batch<Size, Types...>::_row(
+    Self& self,
+    size_type row,
+    pack_index_sequence<Indices...>
+)
+{
+    using row_reference = std::conditional_t<
+        std::is_const_v<Self>,
+        const_reference,
+        reference
+    >;
+    return row_reference(get<Indices>(self._columns)[row]...);
+}
+
+// Copies the elements of a record into a row
+template <std::size_t Size, class... Types>
+template <class Row, std::size_t... Indices>
+constexpr void batch<Size, Types...>::_load(
+    size_type row,
+    const Row& values,
+    pack_index_sequence<Indices...>
+)
+{
+    ((get<Indices>(_columns)[row] = get<Indices>(values)), ...);
+}
+
+// Copies the elements of a row into the writable elements of a record or of
+// a reference pack
+template <std::size_t Size, class... Types>
+template <class Row, std::size_t... Indices>
+constexpr void batch<Size, Types...>::_store(
+    size_type row,
+    Row& values,
+    pack_index_sequence<Indices...>
+) const
+{
+    (_assign(get<Indices>(values), get<Indices>(_columns)[row]), ...);
+}
+
+// Assigns a value to an element if it is writable, and does nothing otherwise
+template <std::size_t Size, class... Types>
+template <class Element, class Type>
+constexpr void batch<Size, Types...>::_assign(
+    Element&& element,
+    const Type& value
+)
+{
+    if constexpr (std::is_assignable_v<Element&&, const Type&>) {
+        std::forward<Element>(element) = value;
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------------- BATCH: GET ------------------------------- //
+// Returns a reference to the column at the given index
+template <std::size_t Index, std::size_t Size, class... Types>
+constexpr auto& get(
+    batch<Size, Types...>& block
+) noexcept
+{
+    return get<Index>(block.columns());
+}
+
+// Returns an immutable reference to the column at the given index
+template <std::size_t Index, std::size_t Size, class... Types>
+constexpr const auto& get(
+    const batch<Size, Types...>& block
+) noexcept
+{
+    return get<Index>(block.columns());
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------------- FOR EACH BATCH ----------------------------- //
+// Hands the records of a range to a kernel by blocks, then one by one: the
+// writable columns of the blocks are written back, the immutable ones skipped
+template <std::size_t Size, class Range, class Kernel>
+constexpr void for_each_batch(
+    Range&& range,
+    Kernel&& kernel
+)
+{
+    using row_type = std::decay_t<decltype(*std::begin(range))>;
+    using difference_type = typename std::iterator_traits<
+        decltype(std::begin(range))
+    >::difference_type;
+    constexpr difference_type size = Size;
+    make_batch<Size, row_type> block{};
+    auto first = std::begin(range);
+    const auto last = std::end(range);
+    auto count = std::distance(first, last);
+    for (; count >= size; count -= size) {
+        auto it = first;
+        for (std::size_t row = 0; row < Size; ++row, ++it) {
+            block.load(row, *it);
+        }
+        kernel(block);
+        for (std::size_t row = 0; row < Size; ++row, ++first) {
+            block.store(row, *first);
+        }
+    }
+    for (; first != last; ++first) {
+        kernel(*first);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _PACK_BATCH_HPP_INCLUDED
+// ========================================================================== //
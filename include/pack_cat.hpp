@@ -0,0 +1,619 @@
+// ================================ PACK CAT ================================ //
+// Project:         Pack
+// Name:            pack_cat.hpp
+// Description:     Concatenation and flattening of packs
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_CAT_HPP_INCLUDED
+#define _PACK_CAT_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "empty_pack.hpp"
+#include "type_pack.hpp"
+#include "nontype_pack.hpp"
+#include "type_template_pack.hpp"
+#include "nontype_template_pack.hpp"
+#include "mixed_template_pack.hpp"
+#include "object_pack.hpp"
+#include "reference_pack.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ******************************* PACK JOIN ******************************** */
+// Pack join structure declaration: the concatenation of packs of the same
+// kind, eight at a time, skipping the empty packs, so that the intermediate
+// packs are few
+template <class... Packs>
+struct pack_join;
+
+// Pack join structure specialization: no pack
+template <>
+struct pack_join<>
+{
+    using type = empty_pack;
+};
+
+// Pack join structure specialization: leading empty pack
+template <class... Packs>
+struct pack_join<empty_pack, Packs...>
+: pack_join<Packs...>
+{
+};
+
+// Pack join structure specialization: one pack of types
+template <
+    template <class...> class Pack,
+    class... Types
+>
+struct pack_join<Pack<Types...>>
+{
+    using type = Pack<Types...>;
+};
+
+// Pack join structure specialization: pack of types and empty pack
+template <
+    template <class...> class Pack,
+    class... Types,
+    class... Packs
+>
+struct pack_join<Pack<Types...>, empty_pack, Packs...>
+: pack_join<Pack<Types...>, Packs...>
+{
+};
+
+// Pack join structure specialization: two packs of types
+template <
+    template <class...> class Pack,
+    class... Types0,
+    class... Types1,
+    class... Packs
+>
+struct pack_join<Pack<Types0...>, Pack<Types1...>, Packs...>
+: pack_join<Pack<Types0..., Types1...>, Packs...>
+{
+};
+
+// Pack join structure specialization: eight packs of types
+template <
+    template <class...> class Pack,
+    class... Types0,
+    class... Types1,
+    class... Types2,
+    class... Types3,
+    class... Types4,
+    class... Types5,
+    class... Types6,
+    class... Types7,
+    class... Packs
+>
+struct pack_join<
+    Pack<Types0...>,
+    Pack<Types1...>,
+    Pack<Types2...>,
+    Pack<Types3...>,
+    Pack<Types4...>,
+    Pack<Types5...>,
+    Pack<Types6...>,
+    Pack<Types7...>,
+    Packs...
+>
+: pack_join<
+    Pack<
+        Types0...,
+        Types1...,
+        Types2...,
+        Types3...,
+        Types4...,
+        Types5...,
+        Types6...,
+        Types7...
+    >,
+    Packs...
+>
+{
+};
+
+// Pack join structure specialization: one pack of non-types
+template <
+    template <auto...> class Pack,
+    auto... Nontypes
+>
+struct pack_join<Pack<Nontypes...>>
+{
+    using type = Pack<Nontypes...>;
+};
+
+// Pack join structure specialization: pack of non-types and empty pack
+template <
+    template <auto...> class Pack,
+    auto... Nontypes,
+    class... Packs
+>
+struct pack_join<Pack<Nontypes...>, empty_pack, Packs...>
+: pack_join<Pack<Nontypes...>, Packs...>
+{
+};
+
+// Pack join structure specialization: two packs of non-types
+template <
+    template <auto...> class Pack,
+    auto... Nontypes0,
+    auto... Nontypes1,
+    class... Packs
+>
+struct pack_join<Pack<Nontypes0...>, Pack<Nontypes1...>, Packs...>
+: pack_join<Pack<Nontypes0..., Nontypes1...>, Packs...>
+{
+};
+
+// Pack join structure specialization: eight packs of non-types
+template <
+    template <auto...> class Pack,
+    auto... Nontypes0,
+    auto... Nontypes1,
+    auto... Nontypes2,
+    auto... Nontypes3,
+    auto... Nontypes4,
+    auto... Nontypes5,
+    auto... Nontypes6,
+    auto... Nontypes7,
+    class... Packs
+>
+struct pack_join<
+    Pack<Nontypes0...>,
+    Pack<Nontypes1...>,
+    Pack<Nontypes2...>,
+    Pack<Nontypes3...>,
+    Pack<Nontypes4...>,
+    Pack<Nontypes5...>,
+    Pack<Nontypes6...>,
+    Pack<Nontypes7...>,
+    Packs...
+>
+: pack_join<
+    Pack<
+        Nontypes0...,
+        Nontypes1...,
+        Nontypes2...,
+        Nontypes3...,
+        Nontypes4...,
+        Nontypes5...,
+        Nontypes6...,
+        Nontypes7...
+    >,
+    Packs...
+>
+{
+};
+
+// Pack join structure specialization: one pack of type templates
+template <
+    template <template <class...> class...> class Pack,
+    template <class...> class... Templates
+>
+struct pack_join<Pack<Templates...>>
+{
+    using type = Pack<Templates...>;
+};
+
+// Pack join structure specialization: pack of type templates and empty pack
+template <
+    template <template <class...> class...> class Pack,
+    template <class...> class... Templates,
+    class... Packs
+>
+struct pack_join<Pack<Templates...>, empty_pack, Packs...>
+: pack_join<Pack<Templates...>, Packs...>
+{
+};
+
+// Pack join structure specialization: two packs of type templates
+template <
+    template <template <class...> class...> class Pack,
+    template <class...> class... Templates0,
+    template <class...> class... Templates1,
+    class... Packs
+>
+struct pack_join<Pack<Templates0...>, Pack<Templates1...>, Packs...>
+: pack_join<Pack<Templates0..., Templates1...>, Packs...>
+{
+};
+
+// Pack join structure specialization: eight packs of type templates
+template <
+    template <template <class...> class...> class Pack,
+    template <class...> class... Templates0,
+    template <class...> class... Templates1,
+    template <class...> class... Templates2,
+    template <class...> class... Templates3,
+    template <class...> class... Templates4,
+    template <class...> class... Templates5,
+    template <class...> class... Templates6,
+    template <class...> class... Templates7,
+    class... Packs
+>
+struct pack_join<
+    Pack<Templates0...>,
+    Pack<Templates1...>,
+    Pack<Templates2...>,
+    Pack<Templates3...>,
+    Pack<Templates4...>,
+    Pack<Templates5...>,
+    Pack<Templates6...>,
+    Pack<Templates7...>,
+    Packs...
+>
+: pack_join<
+    Pack<
+        Templates0...,
+        Templates1...,
+        Templates2...,
+        Templates3...,
+        Templates4...,
+        Templates5...,
+        Templates6...,
+        Templates7...
+    >,
+    Packs...
+>
+{
+};
+
+// Pack join structure specialization: one pack of non-type templates
+template <
+    template <template <auto...> class...> class Pack,
+    template <auto...> class... Templates
+>
+struct pack_join<Pack<Templates...>>
+{
+    using type = Pack<Templates...>;
+};
+
+// Pack join structure specialization: pack of non-type templates and empty pack
+template <
+    template <template <auto...> class...> class Pack,
+    template <auto...> class... Templates,
+    class... Packs
+>
+struct pack_join<Pack<Templates...>, empty_pack, Packs...>
+: pack_join<Pack<Templates...>, Packs...>
+{
+};
+
+// Pack join structure specialization: two packs of non-type templates
+template <
+    template <template <auto...> class...> class Pack,
+    template <auto...> class... Templates0,
+    template <auto...> class... Templates1,
+    class... Packs
+>
+struct pack_join<Pack<Templates0...>, Pack<Templates1...>, Packs...>
+: pack_join<Pack<Templates0..., Templates1...>, Packs...>
+{
+};
+
+// Pack join structure specialization: eight packs of non-type templates
+template <
+    template <template <auto...> class...> class Pack,
+    template <auto...> class... Templates0,
+    template <auto...> class... Templates1,
+    template <auto...> class... Templates2,
+    template <auto...> class... Templates3,
+    template <auto...> class... Templates4,
+    template <auto...> class... Templates5,
+    template <auto...> class... Templates6,
+    template <auto...> class... Templates7,
+    class... Packs
+>
+struct pack_join<
+    Pack<Templates0...>,
+    Pack<Templates1...>,
+    Pack<Templates2...>,
+    Pack<Templates3...>,
+    Pack<Templates4...>,
+    Pack<Templates5...>,
+    Pack<Templates6...>,
+    Pack<Templates7...>,
+    Packs...
+>
+: pack_join<
+    Pack<
+        Templates0...,
+        Templates1...,
+        Templates2...,
+        Templates3...,
+        Templates4...,
+        Templates5...,
+        Templates6...,
+        Templates7...
+    >,
+    Packs...
+>
+{
+};
+
+// Pack join structure specialization: one pack of mixed templates
+template <
+    template <template <class, auto...> class...> class Pack,
+    template <class, auto...> class... Templates
+>
+struct pack_join<Pack<Templates...>>
+{
+    using type = Pack<Templates...>;
+};
+
+// Pack join structure specialization: pack of mixed templates and empty pack
+template <
+    template <template <class, auto...> class...> class Pack,
+    template <class, auto...> class... Templates,
+    class... Packs
+>
+struct pack_join<Pack<Templates...>, empty_pack, Packs...>
+: pack_join<Pack<Templates...>, Packs...>
+{
+};
+
+// Pack join structure specialization: two packs of mixed templates
+template <
+    template <template <class, auto...> class...> class Pack,
+    template <class, auto...> class... Templates0,
+    template <class, auto...> class... Templates1,
+    class... Packs
+>
+struct pack_join<Pack<Templates0...>, Pack<Templates1...>, Packs...>
+: pack_join<Pack<Templates0..., Templates1...>, Packs...>
+{
+};
+
+// Pack join structure specialization: eight packs of mixed templates
+template <
+    template <template <class, auto...> class...> class Pack,
+    template <class, auto...> class... Templates0,
+    template <class, auto...> class... Templates1,
+    template <class, auto...> class... Templates2,
+    template <class, auto...> class... Templates3,
+    template <class, auto...> class... Templates4,
+    template <class, auto...> class... Templates5,
+    template <class, auto...> class... Templates6,
+    template <class, auto...> class... Templates7,
+    class... Packs
+>
+struct pack_join<
+    Pack<Templates0...>,
+    Pack<Templates1...>,
+    Pack<Templates2...>,
+    Pack<Templates3...>,
+    Pack<Templates4...>,
+    Pack<Templates5...>,
+    Pack<Templates6...>,
+    Pack<Templates7...>,
+    Packs...
+>
+: pack_join<
+    Pack<
+        Templates0...,
+        Templates1...,
+        Templates2...,
+        Templates3...,
+        Templates4...,
+        Templates5...,
+        Templates6...,
+        Templates7...
+    >,
+    Packs...
+>
+{
+};
+/* ************************************************************************** */
+
+
+
+/* ******************************** PACK CAT ******************************** */
+// Pack cat class definition
+template <class... Packs>
+class pack_cat
+{
+    // Implementation details: indices
+    private:
+    using _indices = pack_concatenation_indices<Packs::size()...>;
+
+    // Types
+    public:
+    using type = typename pack_join<Packs...>::type;
+
+    // Concatenation
+    public:
+    template <class... Args>
+    static constexpr type concatenate(Args&&...);
+
+    // Implementation details: concatenation
+    private:
+    template <class Tuple, std::size_t... Indices>
+    static constexpr type _concatenate(
+        Tuple&&,
+        pack_index_sequence<Indices...>
+    );
+    template <std::size_t Index, class Pack>
+    static constexpr decltype(auto) _forward(Pack&&) noexcept;
+    template <std::size_t Index, class... Types>
+    static constexpr decltype(auto) _forward(reference_pack<Types...>&);
+    template <std::size_t Index, class... Types>
+    static constexpr decltype(auto) _forward(
+        const reference_pack<Types...>&
+    );
+};
+
+// Alias template: the packs are joined without instantiating them
+template <class... Packs>
+using cat_t = typename pack_join<Packs...>::type;
+/* ************************************************************************** */
+
+
+
+/* ****************************** PACK FLATTEN ****************************** */
+// Pack flatten structure definition: packs other than type packs are flat
+template <class Pack>
+struct pack_flatten
+{
+    using type = Pack;
+};
+
+// Pack flatten structure specialization: type pack
+template <class... Types>
+struct pack_flatten<type_pack<Types...>>;
+
+// Alias template
+template <class Pack>
+using flatten_t = typename pack_flatten<Pack>::type;
+/* ************************************************************************** */
+
+
+
+/* ******************************* PACK SPLICE ****************************** */
+// Pack splice structure definition: the pack a type contributes when flattened
+template <class Type>
+struct pack_splice
+{
+    using type = type_pack<Type>;
+};
+
+// Pack splice structure specialization: empty pack
+template <>
+struct pack_splice<empty_pack>
+{
+    using type = empty_pack;
+};
+
+// Pack splice structure specialization: type pack
+template <class... Types>
+struct pack_splice<type_pack<Types...>>
+{
+    using type = flatten_t<type_pack<Types...>>;
+};
+
+// Pack flatten structure specialization: type pack
+template <class... Types>
+struct pack_flatten<type_pack<Types...>>
+{
+    using type = cat_t<typename pack_splice<Types>::type...>;
+};
+/* ************************************************************************** */
+
+
+
+/* *********************************** CAT ********************************** */
+// Cat declaration
+template <class... Packs>
+constexpr cat_t<std::remove_cv_t<std::remove_reference_t<Packs>>...> cat(
+    Packs&&...
+);
+/* ************************************************************************** */
+
+
+
+// ------------------------- PACK CAT: CONCATENATION ------------------------ //
+// Concatenates packs, moving the elements of rvalue object packs
+template <class... Packs>
+template <class... Args>
+constexpr typename pack_cat<Packs...>::type pack_cat<Packs...>::concatenate(
+    Args&&... args
+)
+{
+    return _concatenate(
+        std::forward_as_tuple(std::forward<Args>(args)...),
+        make_pack_index_sequence<_indices::size>{}
+    );
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- PACK CAT: IMPLEMENTATION DETAILS --------------------- //
+// Builds the concatenated pack from a tuple of references to the packs
+template <class... Packs>
+template <class Tuple, std::size_t... Indices>
+constexpr typename pack_cat<Packs...>::type pack_cat<Packs...>::_concatenate(
+    Tuple&& tuple,
+    pack_index_sequence<Indices...>
+)
+{
+    return type(
+        _forward<_indices::inner[Indices]>(
+            std::get<_indices::outer[Indices]>(std::forward<Tuple>(tuple))
+        )...
+    );
+}
+
+// Forwards an element of a pack with the value category of the pack
+template <class... Packs>
+template <std::size_t Index, class Pack>
+constexpr decltype(auto) pack_cat<Packs...>::_forward(
+    Pack&& pack
+) noexcept
+{
+    return get<Index>(std::forward<Pack>(pack));
+}
+
+// Forwards an element of an lvalue reference pack as a constant one
+template <class... Packs>
+template <std::size_t Index, class... Types>
+constexpr decltype(auto) pack_cat<Packs...>::_forward(
+    reference_pack<Types...>& pack
+)
+{
+    return _forward<Index>(std::as_const(pack));
+}
+
+// Forwards an element of an lvalue reference pack, copying the objects that
+// the pack owns through its rvalue references instead of moving them
+template <class... Packs>
+template <std::size_t Index, class... Types>
+constexpr decltype(auto) pack_cat<Packs...>::_forward(
+    const reference_pack<Types...>& pack
+)
+{
+    using type = pack_index_lookup_t<Index, Types...>;
+    if constexpr (std::is_rvalue_reference_v<type>) {
+        return std::remove_cv_t<std::remove_reference_t<type>>(
+            get<Index>(pack)
+        );
+    } else {
+        return get<Index>(pack);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------------------- CAT ---------------------------------- //
+// Concatenates object packs or reference packs into a single pack
+template <class... Packs>
+constexpr cat_t<std::remove_cv_t<std::remove_reference_t<Packs>>...> cat(
+    Packs&&... packs
+)
+{
+    return pack_cat<
+        std::remove_cv_t<std::remove_reference_t<Packs>>...
+    >::concatenate(std::forward<Packs>(packs)...);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _PACK_CAT_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,1084 @@
+// ============================= PACK COROUTINE ============================= //
+// Project:         Pack
+// Name:            pack_coroutine.hpp
+// Description:     Coroutine tasks awaited together into object packs
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_COROUTINE_HPP_INCLUDED
+#define _PACK_COROUTINE_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <new>
+#include <deque>
+#include <cassert>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+#include <variant>
+#include <utility>
+#include <optional>
+#include <exception>
+#include <functional>
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define PCK_HAS_COROUTINES 1
+#endif
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "object_pack.hpp"
+// Third-party libraries
+// Miscellaneous
+#if defined(PCK_HAS_COROUTINES)
+namespace pck {
+template <class>
+class task;
+// ========================================================================== //
+
+
+
+/* **************************** TASK ARENA BASE ***************************** */
+// Task arena base class definition: a bump allocator for coroutine frames
+class task_arena_base
+{
+    // Types
+    public:
+    using size_type = std::size_t;
+
+    // Lifecycle
+    public:
+    task_arena_base(std::byte*, size_type) noexcept;
+    task_arena_base(const task_arena_base&) = delete;
+    task_arena_base& operator=(const task_arena_base&) = delete;
+
+    // Invocation
+    public:
+    template <class Function>
+    std::invoke_result_t<Function&&> invoke(Function&&);
+
+    // Frames
+    public:
+    static void* allocate(size_type);
+    static void deallocate(void*, size_type) noexcept;
+
+    // Capacity
+    public:
+    size_type capacity() const noexcept;
+    size_type used() const noexcept;
+
+    // Implementation details: scope of the current arena of the thread
+    private:
+    class _scope
+    {
+        public:
+        explicit _scope(task_arena_base*) noexcept;
+        ~_scope();
+        private:
+        task_arena_base* _previous;
+    };
+    void* _allocate(size_type) noexcept;
+
+    // Implementation details: constants
+    private:
+    static constexpr size_type _header = alignof(std::max_align_t);
+
+    // Implementation details: data members
+    private:
+    inline static thread_local task_arena_base* _current = nullptr;
+    std::byte* _data;
+    size_type _capacity;
+    size_type _used;
+    std::atomic<size_type> _live;
+};
+/* ************************************************************************** */
+
+
+
+/* ******************************* TASK ARENA ******************************* */
+// Task arena class definition: the frames of a fan-out in inline storage, the
+// frames created by a resumed coroutine outside of invoke being on the heap
+// unless created through the arena form of when_all
+template <std::size_t Size>
+class task_arena
+: public task_arena_base
+{
+    // Lifecycle
+    public:
+    task_arena() noexcept;
+
+    // Implementation details: data members
+    private:
+    alignas(std::max_align_t) std::byte _storage[Size];
+};
+/* ************************************************************************** */
+
+
+
+/* ****************************** TASK COUNTER ****************************** */
+// Task counter class definition: the last arrival resumes the continuation
+class task_counter
+{
+    // Types
+    public:
+    using size_type = std::size_t;
+
+    // Lifecycle
+    public:
+    explicit task_counter(size_type) noexcept;
+    task_counter(const task_counter&) = delete;
+    task_counter& operator=(const task_counter&) = delete;
+
+    // Synchronization
+    public:
+    void continue_with(std::coroutine_handle<>) noexcept;
+    bool arrive() noexcept;
+    std::coroutine_handle<> continuation() const noexcept;
+
+    // Implementation details: data members
+    private:
+    std::atomic<size_type> _count;
+    std::coroutine_handle<> _continuation;
+};
+/* ************************************************************************** */
+
+
+
+/* *************************** TASK PROMISE BASE **************************** */
+// Task promise base class definition: allocation and continuation
+class task_promise_base
+{
+    // Implementation details: final awaiter
+    private:
+    struct _final_awaiter {
+        bool await_ready() const noexcept;
+        template <class Promise>
+        std::coroutine_handle<> await_suspend(
+            std::coroutine_handle<Promise>
+        ) const noexcept;
+        void await_resume() const noexcept;
+    };
+
+    // Allocation
+    public:
+    static void* operator new(std::size_t);
+    static void operator delete(void*, std::size_t) noexcept;
+
+    // Suspension
+    public:
+    std::suspend_always initial_suspend() const noexcept;
+    _final_awaiter final_suspend() const noexcept;
+    void unhandled_exception() noexcept;
+
+    // Continuation
+    public:
+    void continue_with(std::coroutine_handle<>) noexcept;
+    void join(task_counter&) noexcept;
+
+    // Implementation details: completion
+    protected:
+    void _rethrow() const;
+    private:
+    std::coroutine_handle<> _next() const noexcept;
+
+    // Implementation details: data members
+    private:
+    std::coroutine_handle<> _continuation = nullptr;
+    task_counter* _counter = nullptr;
+    std::exception_ptr _exception = nullptr;
+};
+/* ************************************************************************** */
+
+
+
+/* ****************************** TASK PROMISE ****************************** */
+// Task promise class definition: a coroutine producing a value
+template <class Type>
+class task_promise
+: public task_promise_base
+{
+    // Coroutine
+    public:
+    task<Type> get_return_object() noexcept;
+    template <class Value>
+    void return_value(Value&&);
+
+    // Result
+    public:
+    Type result();
+
+    // Implementation details: data members
+    private:
+    std::optional<Type> _value;
+};
+
+// Task promise class specialization: a coroutine producing nothing
+template <>
+class task_promise<void>
+: public task_promise_base
+{
+    // Coroutine
+    public:
+    task<void> get_return_object() noexcept;
+    void return_void() const noexcept;
+
+    // Result
+    public:
+    void result() const;
+};
+/* ************************************************************************** */
+
+
+
+/* ********************************** TASK ********************************** */
+// Task class definition: a lazy coroutine awaited once
+template <class Type = void>
+class task
+{
+    // Types
+    public:
+    using value_type = Type;
+    using promise_type = task_promise<Type>;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    // Implementation details: awaiter
+    private:
+    struct _awaiter {
+        bool await_ready() const noexcept;
+        std::coroutine_handle<> await_suspend(
+            std::coroutine_handle<>
+        ) const noexcept;
+        value_type await_resume() const;
+        handle_type handle;
+    };
+
+    // Lifecycle
+    public:
+    task() noexcept;
+    explicit task(handle_type) noexcept;
+    task(const task&) = delete;
+    task(task&&) noexcept;
+    task& operator=(const task&) = delete;
+    task& operator=(task&&) noexcept;
+    ~task();
+
+    // Await
+    public:
+    _awaiter operator co_await() && noexcept;
+
+    // Observers
+    public:
+    bool done() const noexcept;
+    handle_type handle() const noexcept;
+
+    // Implementation details: data members
+    private:
+    handle_type _handle;
+};
+/* ************************************************************************** */
+
+
+
+/* **************************** WHEN ALL RESULT ***************************** */
+// When all result structure definition: the value of a task in the results
+template <class Type>
+struct when_all_result
+{
+    using type = Type;
+};
+
+// When all result structure specialization: tasks producing nothing
+template <>
+struct when_all_result<void>
+{
+    using type = std::monostate;
+};
+
+// Alias template
+template <class Type>
+using when_all_result_t = typename when_all_result<Type>::type;
+/* ************************************************************************** */
+
+
+
+/* *************************** WHEN ALL AWAITABLE *************************** */
+// When all awaitable class definition: starts the tasks and joins them
+template <class... Types>
+class when_all_awaitable
+{
+    // Types
+    public:
+    using size_type = std::size_t;
+    using value_type = object_pack<when_all_result_t<Types>...>;
+    using index_sequence = make_pack_index_sequence<sizeof...(Types)>;
+
+    // Lifecycle
+    public:
+    explicit when_all_awaitable(task<Types>&&...) noexcept;
+    when_all_awaitable(const when_all_awaitable&) = delete;
+    when_all_awaitable& operator=(const when_all_awaitable&) = delete;
+
+    // Await
+    public:
+    bool await_ready() const noexcept;
+    bool await_suspend(std::coroutine_handle<>) noexcept;
+    value_type await_resume();
+
+    // Implementation details: tasks
+    private:
+    template <std::size_t... Indices>
+    void _start(pack_index_sequence<Indices...>) noexcept;
+    template <std::size_t... Indices>
+    value_type _collect(pack_index_sequence<Indices...>);
+    template <class Type>
+    static when_all_result_t<Type> _result(task<Type>&);
+
+    // Implementation details: data members
+    private:
+    object_pack<task<Types>...> _tasks;
+    task_counter _counter;
+};
+/* ************************************************************************** */
+
+
+
+/* ******************************** WHEN ALL ******************************** */
+// When all declaration
+template <class... Types>
+when_all_awaitable<Types...> when_all(task<Types>...) noexcept;
+
+// When all declaration: tasks created in an arena
+template <class... Functions>
+when_all_awaitable<
+    typename std::invoke_result_t<Functions&&>::value_type...
+> when_all(task_arena_base&, Functions&&...);
+/* ************************************************************************** */
+
+
+
+/* ******************************* EVENT LOOP ******************************* */
+// Event loop class definition: resumes posted coroutines on the caller
+class event_loop
+{
+    // Implementation details: schedule awaiter
+    private:
+    struct _schedule_awaiter {
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<>) const;
+        void await_resume() const noexcept;
+        event_loop* loop;
+    };
+
+    // Types
+    public:
+    using size_type = std::size_t;
+
+    // Lifecycle
+    public:
+    event_loop() = default;
+    event_loop(const event_loop&) = delete;
+    event_loop& operator=(const event_loop&) = delete;
+
+    // Scheduling
+    public:
+    _schedule_awaiter schedule() noexcept;
+    void post(std::coroutine_handle<>);
+
+    // Run
+    public:
+    bool run_one();
+    size_type run();
+    template <class Type>
+    Type run(task<Type>);
+
+    // Implementation details: data members
+    private:
+    std::mutex _mutex;
+    std::deque<std::coroutine_handle<>> _queue;
+};
+/* ************************************************************************** */
+
+
+
+// ----------------------- TASK ARENA BASE: LIFECYCLE ----------------------- //
+// Constructs an arena over a buffer aligned for any object
+inline task_arena_base::task_arena_base(
+    std::byte* data,
+    size_type capacity
+) noexcept
+: _data(data)
+, _capacity(capacity)
+, _used(0)
+, _live(0)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- TASK ARENA BASE: INVOCATION ----------------------- //
+// Calls a function allocating in the arena the coroutine frames it creates
+template <class Function>
+std::invoke_result_t<Function&&> task_arena_base::invoke(
+    Function&& function
+)
+{
+    const _scope scope(this);
+    if (_live.load(std::memory_order_acquire) == 0) {
+        _used = 0;
+    }
+    return std::invoke(std::forward<Function>(function));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ TASK ARENA BASE: FRAMES ------------------------- //
+// Allocates a frame in the current arena, or on the heap when there is none
+inline void* task_arena_base::allocate(
+    size_type size
+)
+{
+    const size_type total = _header + size;
+    void* pointer = _current ? _current->_allocate(total) : nullptr;
+    task_arena_base* owner = pointer ? _current : nullptr;
+    if (!pointer) {
+        pointer = ::operator new(total);
+    }
+    ::new (pointer) task_arena_base*(owner);
+    return static_cast<std::byte*>(pointer) + _header;
+}
+
+// Releases a frame to its arena, or to the heap
+inline void task_arena_base::deallocate(
+    void* frame,
+    size_type size
+) noexcept
+{
+    std::byte* pointer = static_cast<std::byte*>(frame) - _header;
+    task_arena_base* owner = *std::launder(
+        reinterpret_cast<task_arena_base**>(pointer)
+    );
+    if (owner) {
+        owner->_live.fetch_sub(1, std::memory_order_release);
+    } else {
+        ::operator delete(pointer, _header + size);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- TASK ARENA BASE: CAPACITY ------------------------ //
+// Returns the size of the buffer in bytes
+inline typename task_arena_base::size_type task_arena_base::capacity(
+) const noexcept
+{
+    return _capacity;
+}
+
+// Returns the number of bytes given to frames since the last reuse
+inline typename task_arena_base::size_type task_arena_base::used(
+) const noexcept
+{
+    return _used;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------- TASK ARENA BASE: IMPLEMENTATION DETAILS ----------------- //
+// Makes an arena the current one of the thread
+inline task_arena_base::_scope::_scope(
+    task_arena_base* arena
+) noexcept
+: _previous(std::exchange(_current, arena))
+{
+}
+
+// Restores the previous current arena of the thread
+inline task_arena_base::_scope::~_scope(
+)
+{
+    _current = _previous;
+}
+
+// Bumps the used size, or returns null when the buffer is exhausted
+inline void* task_arena_base::_allocate(
+    size_type size
+) noexcept
+{
+    const size_type aligned = (size + _header - 1) / _header * _header;
+    void* pointer = nullptr;
+    if (aligned <= _capacity - _used) {
+        pointer = _data + _used;
+        _used += aligned;
+        _live.fetch_add(1, std::memory_order_relaxed);
+    }
+    return pointer;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- TASK ARENA: LIFECYCLE -------------------------- //
+// Constructs an arena over the inline storage
+template <std::size_t Size>
+task_arena<Size>::task_arena(
+) noexcept
+: task_arena_base(_storage, Size)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ TASK COUNTER: LIFECYCLE ------------------------- //
+// Constructs a counter expecting the given number of arrivals
+inline task_counter::task_counter(
+    size_type count
+) noexcept
+: _count(count)
+, _continuation(nullptr)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- TASK COUNTER: SYNCHRONIZATION ---------------------- //
+// Sets the coroutine to resume after the last arrival
+inline void task_counter::continue_with(
+    std::coroutine_handle<> continuation
+) noexcept
+{
+    _continuation = continuation;
+}
+
+// Counts an arrival and returns whether it is the last one
+inline bool task_counter::arrive(
+) noexcept
+{
+    return _count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+// Returns the coroutine to resume after the last arrival
+inline std::coroutine_handle<> task_counter::continuation(
+) const noexcept
+{
+    return _continuation;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- TASK PROMISE BASE: ALLOCATION ---------------------- //
+// Allocates a coroutine frame, in the current arena if any
+inline void* task_promise_base::operator new(
+    std::size_t size
+)
+{
+    return task_arena_base::allocate(size);
+}
+
+// Deallocates a coroutine frame
+inline void task_promise_base::operator delete(
+    void* frame,
+    std::size_t size
+) noexcept
+{
+    task_arena_base::deallocate(frame, size);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- TASK PROMISE BASE: SUSPENSION ---------------------- //
+// Suspends the coroutine until it is awaited
+inline std::suspend_always task_promise_base::initial_suspend(
+) const noexcept
+{
+    return {};
+}
+
+// Suspends the coroutine at the end, and transfers to what comes next
+inline task_promise_base::_final_awaiter task_promise_base::final_suspend(
+) const noexcept
+{
+    return {};
+}
+
+// Stores the exception to rethrow it to the awaiting coroutine
+inline void task_promise_base::unhandled_exception(
+) noexcept
+{
+    _exception = std::current_exception();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- TASK PROMISE BASE: CONTINUATION --------------------- //
+// Sets the coroutine to resume at the end
+inline void task_promise_base::continue_with(
+    std::coroutine_handle<> continuation
+) noexcept
+{
+    _continuation = continuation;
+}
+
+// Makes the end an arrival on a counter shared with other tasks
+inline void task_promise_base::join(
+    task_counter& counter
+) noexcept
+{
+    _counter = &counter;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------- TASK PROMISE BASE: IMPLEMENTATION DETAILS ---------------- //
+// Never skips the final suspension
+inline bool task_promise_base::_final_awaiter::await_ready(
+) const noexcept
+{
+    return false;
+}
+
+// Transfers to the continuation, or to the awaiter of the last joined task
+template <class Promise>
+std::coroutine_handle<> task_promise_base::_final_awaiter::await_suspend(
+    std::coroutine_handle<Promise> handle
+) const noexcept
+{
+    return handle.promise()._next();
+}
+
+// Never resumes: the coroutine is destroyed by its task
+inline void task_promise_base::_final_awaiter::await_resume(
+) const noexcept
+{
+}
+
+// Rethrows the exception that ended the coroutine, if any
+inline void task_promise_base::_rethrow(
+) const
+{
+    if (_exception) {
+        std::rethrow_exception(_exception);
+    }
+}
+
+// Returns the coroutine to resume once this one is done
+inline std::coroutine_handle<> task_promise_base::_next(
+) const noexcept
+{
+    std::coroutine_handle<> next = std::noop_coroutine();
+    if (_counter) {
+        next = _counter->arrive() ? _counter->continuation() : next;
+    } else if (_continuation) {
+        next = _continuation;
+    }
+    return next;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ TASK PROMISE: COROUTINE ------------------------- //
+// Returns the task owning the coroutine
+template <class Type>
+task<Type> task_promise<Type>::get_return_object(
+) noexcept
+{
+    return task<Type>(std::coroutine_handle<task_promise>::from_promise(*this));
+}
+
+// Stores the value produced by the coroutine
+template <class Type>
+template <class Value>
+void task_promise<Type>::return_value(
+    Value&& value
+)
+{
+    _value.emplace(std::forward<Value>(value));
+}
+
+// Returns the task owning the coroutine: nothing produced
+inline task<void> task_promise<void>::get_return_object(
+) noexcept
+{
+    return task<void>(std::coroutine_handle<task_promise>::from_promise(*this));
+}
+
+// Ends the coroutine: nothing produced
+inline void task_promise<void>::return_void(
+) const noexcept
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- TASK PROMISE: RESULT -------------------------- //
+// Moves the value out, or rethrows the exception that ended the coroutine
+template <class Type>
+Type task_promise<Type>::result(
+)
+{
+    _rethrow();
+    return std::move(*_value);
+}
+
+// Rethrows the exception that ended the coroutine, if any: nothing produced
+inline void task_promise<void>::result(
+) const
+{
+    _rethrow();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- TASK: LIFECYCLE ----------------------------- //
+// Constructs a task without coroutine
+template <class Type>
+task<Type>::task(
+) noexcept
+: _handle(nullptr)
+{
+}
+
+// Constructs a task owning a coroutine
+template <class Type>
+task<Type>::task(
+    handle_type handle
+) noexcept
+: _handle(handle)
+{
+}
+
+// Takes the coroutine of another task
+template <class Type>
+task<Type>::task(
+    task&& other
+) noexcept
+: _handle(std::exchange(other._handle, nullptr))
+{
+}
+
+// Destroys the coroutine, and takes the one of another task
+template <class Type>
+task<Type>& task<Type>::operator=(
+    task&& other
+) noexcept
+{
+    if (this != &other) {
+        if (_handle) {
+            _handle.destroy();
+        }
+        _handle = std::exchange(other._handle, nullptr);
+    }
+    return *this;
+}
+
+// Destroys the coroutine
+template <class Type>
+task<Type>::~task(
+)
+{
+    if (_handle) {
+        _handle.destroy();
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------------ TASK: AWAIT ------------------------------- //
+// Starts the coroutine, resumes the caller at its end, and yields its result
+template <class Type>
+typename task<Type>::_awaiter task<Type>::operator co_await(
+) && noexcept
+{
+    return _awaiter{_handle};
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- TASK: OBSERVERS ----------------------------- //
+// Checks whether the coroutine has finished
+template <class Type>
+bool task<Type>::done(
+) const noexcept
+{
+    return _handle && _handle.done();
+}
+
+// Returns the handle of the coroutine
+template <class Type>
+typename task<Type>::handle_type task<Type>::handle(
+) const noexcept
+{
+    return _handle;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- TASK: IMPLEMENTATION DETAILS ---------------------- //
+// Skips the suspension of the caller when the coroutine has finished
+template <class Type>
+bool task<Type>::_awaiter::await_ready(
+) const noexcept
+{
+    return handle.done();
+}
+
+// Sets the caller as continuation and transfers to the coroutine
+template <class Type>
+std::coroutine_handle<> task<Type>::_awaiter::await_suspend(
+    std::coroutine_handle<> caller
+) const noexcept
+{
+    handle.promise().continue_with(caller);
+    return handle;
+}
+
+// Returns the result of the coroutine
+template <class Type>
+typename task<Type>::value_type task<Type>::_awaiter::await_resume(
+) const
+{
+    return handle.promise().result();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- WHEN ALL AWAITABLE: LIFECYCLE ---------------------- //
+// Takes the tasks, one more arrival being the one of the awaiter
+template <class... Types>
+when_all_awaitable<Types...>::when_all_awaitable(
+    task<Types>&&... tasks
+) noexcept
+: _tasks(std::move(tasks)...)
+, _counter(sizeof...(Types) + 1)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- WHEN ALL AWAITABLE: AWAIT ------------------------ //
+// Never skips the suspension, the tasks being lazy
+template <class... Types>
+bool when_all_awaitable<Types...>::await_ready(
+) const noexcept
+{
+    return false;
+}
+
+// Starts the tasks and suspends the caller unless they all finished already
+template <class... Types>
+bool when_all_awaitable<Types...>::await_suspend(
+    std::coroutine_handle<> caller
+) noexcept
+{
+    _counter.continue_with(caller);
+    _start(index_sequence{});
+    return !_counter.arrive();
+}
+
+// Returns the results, or rethrows the exception of the first failed task
+template <class... Types>
+typename when_all_awaitable<Types...>::value_type
+when_all_awaitable<Types...>::await_resume(
+)
+{
+    return _collect(index_sequence{});
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------- WHEN ALL AWAITABLE: IMPLEMENTATION DETAILS --------------- //
+// Joins the tasks to the counter and starts them one after the other
+template <class... Types>
+template <std::size_t... Indices>
+void when_all_awaitable<Types...>::_start(
+    pack_index_sequence<Indices...>
+) noexcept
+{
+    const std::array<std::coroutine_handle<>, sizeof...(Types)> handles = {
+        get<Indices>(_tasks).handle()...
+    };
+    (get<Indices>(_tasks).handle().promise().join(_counter), ...);
+    for (std::coroutine_handle<> handle : handles) {
+        handle.resume();
+    }
+}
+
+// Moves the results of the tasks into an object pack, in order
+template <class... Types>
+template <std::size_t... Indices>
+typename when_all_awaitable<Types...>::value_type
+when_all_awaitable<Types...>::_collect(
+    pack_index_sequence<Indices...>
+)
+{
+    return value_type{_result(get<Indices>(_tasks))...};
+}
+
+// Returns the result of a task, as an empty value if it produces nothing
+template <class... Types>
+template <class Type>
+when_all_result_t<Type> when_all_awaitable<Types...>::_result(
+    task<Type>& work
+)
+{
+    if constexpr (std::is_void_v<Type>) {
+        work.handle().promise().result();
+        return {};
+    } else {
+        return work.handle().promise().result();
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------------- WHEN ALL -------------------------------- //
+// Awaits several tasks started together, and yields their results
+template <class... Types>
+when_all_awaitable<Types...> when_all(
+    task<Types>... tasks
+) noexcept
+{
+    static_assert(sizeof...(Types) > 0, "there should be tasks to await");
+    return when_all_awaitable<Types...>(std::move(tasks)...);
+}
+
+// Awaits several tasks started together, each created by a function whose
+// coroutine frames are allocated in the arena, and yields their results
+template <class... Functions>
+when_all_awaitable<
+    typename std::invoke_result_t<Functions&&>::value_type...
+> when_all(
+    task_arena_base& arena,
+    Functions&&... functions
+)
+{
+    static_assert(sizeof...(Functions) > 0, "there should be tasks to await");
+    return when_all_awaitable<
+        typename std::invoke_result_t<Functions&&>::value_type...
+    >(arena.invoke(std::forward<Functions>(functions))...);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- EVENT LOOP: SCHEDULING ------------------------- //
+// Returns an awaitable resuming the caller from the loop
+inline event_loop::_schedule_awaiter event_loop::schedule(
+) noexcept
+{
+    return _schedule_awaiter{this};
+}
+
+// Queues a coroutine to resume, possibly from another thread
+inline void event_loop::post(
+    std::coroutine_handle<> handle
+)
+{
+    const std::lock_guard<std::mutex> lock(_mutex);
+    _queue.push_back(handle);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- EVENT LOOP: RUN ----------------------------- //
+// Resumes the first queued coroutine, and returns false if there is none
+inline bool event_loop::run_one(
+)
+{
+    std::coroutine_handle<> handle = nullptr;
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        if (!_queue.empty()) {
+            handle = _queue.front();
+            _queue.pop_front();
+        }
+    }
+    if (handle) {
+        handle.resume();
+    }
+    return static_cast<bool>(handle);
+}
+
+// Resumes queued coroutines until there is none, and returns their number
+inline typename event_loop::size_type event_loop::run(
+)
+{
+    size_type count = 0;
+    while (run_one()) {
+        ++count;
+    }
+    return count;
+}
+
+// Runs a task to completion on the loop, and returns its result
+template <class Type>
+Type event_loop::run(
+    task<Type> work
+)
+{
+    work.handle().promise().continue_with(std::noop_coroutine());
+    post(work.handle());
+    while (!work.done() && run_one()) {
+    }
+    assert(work.done());
+    return work.handle().promise().result();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- EVENT LOOP: IMPLEMENTATION DETAILS ------------------- //
+// Never skips the suspension
+inline bool event_loop::_schedule_awaiter::await_ready(
+) const noexcept
+{
+    return false;
+}
+
+// Queues the caller on the loop
+inline void event_loop::_schedule_awaiter::await_suspend(
+    std::coroutine_handle<> caller
+) const
+{
+    loop->post(caller);
+}
+
+// Resumes on the loop
+inline void event_loop::_schedule_awaiter::await_resume(
+) const noexcept
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // PCK_HAS_COROUTINES
+#endif // _PACK_COROUTINE_HPP_INCLUDED
+// ========================================================================== //
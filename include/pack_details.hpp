@@ -17,6 +17,7 @@
 #include <array>
 #include <tuple>
 #include <cassert>
+#include <utility>
 #include <type_traits>
 // Project sources
 // Third-party libraries
@@ -26,6 +27,75 @@ namespace pck {
 
 
 
+/* ******************************** TYPE TAG ******************************** */
+// Type tag variable template: its address uniquely identifies a type
+template <class Type>
+inline constexpr char type_tag = 0;
+/* ************************************************************************** */
+
+
+
+/* **************************** CACHE LINE SIZE ***************************** */
+// Cache line size: the distance keeping data written by two threads apart
+inline constexpr std::size_t cache_line_size = 64;
+/* ************************************************************************** */
+
+
+
+/* **************************** PACK CONJUNCTION **************************** */
+// Pack conjunction variable template: compares two shifted sequences instead
+// of folding, since folds over thousands of elements are quadratic to compile
+template <bool... Values>
+inline constexpr bool pack_conjunction_v = std::is_same_v<
+    std::integer_sequence<bool, true, Values...>,
+    std::integer_sequence<bool, Values..., true>
+>;
+/* ************************************************************************** */
+
+
+
+/* *********************** PACK CONCATENATION INDICES *********************** */
+// Pack concatenation indices structure definition
+template <std::size_t... Sizes>
+struct pack_concatenation_indices
+{
+    // Implementation details: computation
+    private:
+    static constexpr std::size_t _size = (Sizes + ... + std::size_t(0));
+    static constexpr std::array<std::size_t, _size> _make(bool);
+
+    // Constants
+    public:
+    static constexpr std::size_t size = _size;
+    static constexpr std::array<std::size_t, size> outer = _make(true);
+    static constexpr std::array<std::size_t, size> inner = _make(false);
+};
+/* ************************************************************************** */
+
+
+
+// ----------- PACK CONCATENATION INDICES: IMPLEMENTATION DETAILS ----------- //
+// Computes, for each concatenated element, the index of its pack or within it
+template <std::size_t... Sizes>
+constexpr std::array<std::size_t, pack_concatenation_indices<Sizes...>::_size>
+pack_concatenation_indices<Sizes...>::_make(
+    bool outer
+)
+{
+    constexpr std::size_t sizes[] = {Sizes..., std::size_t(0)};
+    std::array<std::size_t, _size> result = {};
+    std::size_t index = 0;
+    for (std::size_t i = 0; i < sizeof...(Sizes); ++i) {
+        for (std::size_t j = 0; j < sizes[i]; ++j) {
+            result[index++] = outer ? i : j;
+        }
+    }
+    return result;
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ========================================================================== //
 } // namespace pck
 #endif // _PACK_DETAILS_HPP_INCLUDED
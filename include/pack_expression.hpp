@@ -0,0 +1,459 @@
+// ============================ PACK EXPRESSION ============================= //
+// Project:         Pack
+// Name:            pack_expression.hpp
+// Description:     Elementwise expression templates on homogeneous packs
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_EXPRESSION_HPP_INCLUDED
+#define _PACK_EXPRESSION_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <algorithm>
+#include <functional>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "object_pack.hpp"
+#include "reference_pack.hpp"
+#include "pack_tuple.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ************************** IS HOMOGENEOUS PACK *************************** */
+// Is homogeneous pack declaration
+template <class>
+struct is_homogeneous_pack
+: std::false_type
+{
+};
+
+// Is homogeneous pack specialization: object pack
+template <class Type, class... Types>
+struct is_homogeneous_pack<object_pack<Type, Types...>>
+: std::bool_constant<(std::is_same_v<Type, Types> && ...)>
+{
+};
+
+// Is homogeneous pack specialization: reference pack
+template <class Type, class... Types>
+struct is_homogeneous_pack<reference_pack<Type, Types...>>
+: std::bool_constant<
+    (std::is_same_v<std::decay_t<Type>, std::decay_t<Types>> && ...)
+>
+{
+};
+
+// Variable template
+template <class Type>
+inline constexpr bool is_homogeneous_pack_v = is_homogeneous_pack<Type>::value;
+/* ************************************************************************** */
+
+
+
+/* *************************** IS PACK EXPRESSION *************************** */
+// Is pack expression declaration
+template <class>
+struct is_pack_expression
+: std::false_type
+{
+};
+
+// Is pack expression specialization
+template <class Operation, class... Operands>
+struct is_pack_expression<pack_expression<Operation, Operands...>>
+: std::true_type
+{
+};
+
+// Variable template
+template <class Type>
+inline constexpr bool is_pack_expression_v = is_pack_expression<Type>::value;
+/* ************************************************************************** */
+
+
+
+/* ************************ PACK EXPRESSION OPERAND ************************* */
+// Pack expression operand structure definition: how an argument is stored
+template <class Type>
+struct pack_expression_operand
+{
+    // Kind of operand
+    static constexpr bool is_pack = is_homogeneous_pack_v<std::decay_t<Type>>
+    || is_pack_expression_v<std::decay_t<Type>>;
+    static constexpr bool value = is_pack
+    || std::is_arithmetic_v<std::decay_t<Type>>;
+
+    // Stored type: lvalue packs by reference, everything else by value
+    using type = std::conditional_t<
+        std::is_lvalue_reference_v<Type>
+        && is_homogeneous_pack_v<std::decay_t<Type>>,
+        const std::decay_t<Type>&,
+        std::decay_t<Type>
+    >;
+
+    // Number of elements, zero for scalars
+    static constexpr std::size_t size = std::conditional_t<
+        is_pack,
+        std::tuple_size<std::decay_t<Type>>,
+        std::integral_constant<std::size_t, 0>
+    >::value;
+};
+
+// Alias template
+template <class Type>
+using pack_expression_operand_t = typename pack_expression_operand<Type>::type;
+
+// Enables operators when at least one pack is involved along with scalars
+template <class... Types>
+using if_pack_expression_operands_t = std::enable_if_t<
+    (pack_expression_operand<Types>::value && ...)
+    && (pack_expression_operand<Types>::is_pack || ...)
+>;
+/* ************************************************************************** */
+
+
+
+/* **************************** PACK EXPRESSION ***************************** */
+// Pack expression class definition: an elementwise operation evaluated lazily
+template <class Operation, class... Operands>
+class pack_expression
+{
+    // Implementation details: size
+    private:
+    static constexpr std::size_t _size = std::max({
+        pack_expression_operand<Operands>::size...
+    });
+    static_assert(
+        ((pack_expression_operand<Operands>::size == 0
+        || pack_expression_operand<Operands>::size == _size) && ...),
+        "mismatching pack sizes"
+    );
+
+    // Types
+    public:
+    using operation_type = Operation;
+    using size_type = std::size_t;
+
+    // Lifecycle
+    public:
+    template <class... Args>
+    explicit constexpr pack_expression(const Operation&, Args&&...);
+
+    // Access
+    public:
+    template <std::size_t Index>
+    constexpr auto operator[](pack_index<Index>) const;
+
+    // Size
+    public:
+    static constexpr size_type size() noexcept;
+
+    // Implementation details: evaluation
+    private:
+    template <std::size_t Index, class Operand>
+    static constexpr decltype(auto) _evaluate(const Operand&);
+    template <std::size_t Index, std::size_t... Positions>
+    constexpr auto _apply(pack_index_sequence<Positions...>) const;
+
+    // Implementation details: data members
+    private:
+    Operation _operation;
+    std::tuple<Operands...> _operands;
+};
+/* ************************************************************************** */
+
+
+
+/* ************************** PACK EXPRESSION: GET ************************** */
+// Pack expression get declaration
+template <std::size_t Index, class Operation, class... Operands>
+constexpr auto get(const pack_expression<Operation, Operands...>&);
+/* ************************************************************************** */
+
+
+
+/* *********************** PACK EXPRESSION: OPERATORS *********************** */
+// Pack expression arithmetic operators declaration
+template <class Lhs, class Rhs, class = if_pack_expression_operands_t<Lhs, Rhs>>
+constexpr pack_expression<
+    std::plus<>,
+    pack_expression_operand_t<Lhs>,
+    pack_expression_operand_t<Rhs>
+> operator+(Lhs&&, Rhs&&);
+template <class Lhs, class Rhs, class = if_pack_expression_operands_t<Lhs, Rhs>>
+constexpr pack_expression<
+    std::minus<>,
+    pack_expression_operand_t<Lhs>,
+    pack_expression_operand_t<Rhs>
+> operator-(Lhs&&, Rhs&&);
+template <class Lhs, class Rhs, class = if_pack_expression_operands_t<Lhs, Rhs>>
+constexpr pack_expression<
+    std::multiplies<>,
+    pack_expression_operand_t<Lhs>,
+    pack_expression_operand_t<Rhs>
+> operator*(Lhs&&, Rhs&&);
+template <class Lhs, class Rhs, class = if_pack_expression_operands_t<Lhs, Rhs>>
+constexpr pack_expression<
+    std::divides<>,
+    pack_expression_operand_t<Lhs>,
+    pack_expression_operand_t<Rhs>
+> operator/(Lhs&&, Rhs&&);
+template <class Operand, class = if_pack_expression_operands_t<Operand>>
+constexpr pack_expression<
+    std::negate<>,
+    pack_expression_operand_t<Operand>
+> operator-(Operand&&);
+/* ************************************************************************** */
+
+
+
+/* ******************************** EVALUATE ******************************** */
+// Evaluate declaration
+template <class Operation, class... Operands>
+constexpr auto evaluate(const pack_expression<Operation, Operands...>&);
+/* ************************************************************************** */
+
+
+
+// ----------------------- PACK EXPRESSION: LIFECYCLE ----------------------- //
+// Explicitly constructs an expression from an operation and its operands
+template <class Operation, class... Operands>
+template <class... Args>
+constexpr pack_expression<Operation, Operands...>::pack_expression(
+    const Operation& operation,
+    Args&&... args
+)
+: _operation(operation)
+, _operands(std::forward<Args>(args)...)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ PACK EXPRESSION: ACCESS ------------------------- //
+// Evaluates the element at the given index through the whole expression
+template <class Operation, class... Operands>
+template <std::size_t Index>
+constexpr auto pack_expression<Operation, Operands...>::operator[](
+    pack_index<Index>
+) const
+{
+    return _apply<Index>(make_pack_index_sequence<sizeof...(Operands)>{});
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- PACK EXPRESSION: SIZE -------------------------- //
+// Returns the number of elements of the expression
+template <class Operation, class... Operands>
+constexpr typename pack_expression<Operation, Operands...>::size_type
+pack_expression<Operation, Operands...>::size(
+) noexcept
+{
+    return _size;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------- PACK EXPRESSION: IMPLEMENTATION DETAILS ----------------- //
+// Returns the element of a pack operand, or a scalar operand as is
+template <class Operation, class... Operands>
+template <std::size_t Index, class Operand>
+constexpr decltype(auto) pack_expression<Operation, Operands...>::_evaluate(
+    const Operand& operand
+)
+{
+    if constexpr (pack_expression_operand<Operand>::is_pack) {
+        return get<Index>(operand);
+    } else {
+        return operand;
+    }
+}
+
+// Applies the operation to the elements of the operands at the given index
+template <class Operation, class... Operands>
+template <std::size_t Index, std::size_t... Positions>
+constexpr auto pack_expression<Operation, Operands...>::_apply(
+    pack_index_sequence<Positions...>
+) const
+{
+    return _operation(_evaluate<Index>(std::get<Positions>(_operands))...);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- PACK EXPRESSION: GET -------------------------- //
+// Evaluates the element of an expression at the given index
+template <std::size_t Index, class Operation, class... Operands>
+constexpr auto get(
+    const pack_expression<Operation, Operands...>& expression
+)
+{
+    return expression[pack_index_v<Index>];
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK EXPRESSION: OPERATORS ----------------------- //
+// Builds an elementwise addition
+template <class Lhs, class Rhs, class>
+constexpr pack_expression<
+    std::plus<>,
+    pack_expression_operand_t<Lhs>,
+    pack_expression_operand_t<Rhs>
+> operator+(
+    Lhs&& lhs,
+    Rhs&& rhs
+)
+{
+    return pack_expression<
+        std::plus<>,
+        pack_expression_operand_t<Lhs>,
+        pack_expression_operand_t<Rhs>
+    >(std::plus<>(), std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+// Builds an elementwise subtraction
+template <class Lhs, class Rhs, class>
+constexpr pack_expression<
+    std::minus<>,
+    pack_expression_operand_t<Lhs>,
+    pack_expression_operand_t<Rhs>
+> operator-(
+    Lhs&& lhs,
+    Rhs&& rhs
+)
+{
+    return pack_expression<
+        std::minus<>,
+        pack_expression_operand_t<Lhs>,
+        pack_expression_operand_t<Rhs>
+    >(std::minus<>(), std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+// Builds an elementwise multiplication
+template <class Lhs, class Rhs, class>
+constexpr pack_expression<
+    std::multiplies<>,
+    pack_expression_operand_t<Lhs>,
+    pack_expression_operand_t<Rhs>
+> operator*(
+    Lhs&& lhs,
+    Rhs&& rhs
+)
+{
+    return pack_expression<
+        std::multiplies<>,
+        pack_expression_operand_t<Lhs>,
+        pack_expression_operand_t<Rhs>
+    >(std::multiplies<>(), std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+// Builds an elementwise division
+template <class Lhs, class Rhs, class>
+constexpr pack_expression<
+    std::divides<>,
+    pack_expression_operand_t<Lhs>,
+    pack_expression_operand_t<Rhs>
+> operator/(
+    Lhs&& lhs,
+    Rhs&& rhs
+)
+{
+    return pack_expression<
+        std::divides<>,
+        pack_expression_operand_t<Lhs>,
+        pack_expression_operand_t<Rhs>
+    >(std::divides<>(), std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+// Builds an elementwise negation
+template <class Operand, class>
+constexpr pack_expression<
+    std::negate<>,
+    pack_expression_operand_t<Operand>
+> operator-(
+    Operand&& operand
+)
+{
+    return pack_expression<
+        std::negate<>,
+        pack_expression_operand_t<Operand>
+    >(std::negate<>(), std::forward<Operand>(operand));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------------- EVALUATE -------------------------------- //
+// Evaluates an expression once into a new object pack
+template <class Operation, class... Operands>
+constexpr auto evaluate(
+    const pack_expression<Operation, Operands...>& expression
+)
+{
+    return pck::apply([](auto&&... values) {
+        return object_pack<std::decay_t<decltype(values)>...>(
+            std::forward<decltype(values)>(values)...
+        );
+    }, expression);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+namespace std {
+// ========================================================================== //
+
+
+
+/* ********************** TUPLE SIZE: PACK EXPRESSION *********************** */
+// Tuple size specialization for pack expressions
+template <class Operation, class... Operands>
+struct tuple_size<pck::pack_expression<Operation, Operands...>>
+: integral_constant<
+    size_t,
+    pck::pack_expression<Operation, Operands...>::size()
+>
+{
+};
+/* ************************************************************************** */
+
+
+
+/* ********************* TUPLE ELEMENT: PACK EXPRESSION ********************* */
+// Tuple element specialization for pack expressions
+template <size_t Index, class Operation, class... Operands>
+struct tuple_element<Index, pck::pack_expression<Operation, Operands...>>
+{
+    using type = decltype(
+        declval<const pck::pack_expression<Operation, Operands...>&>()[
+            pck::pack_index_v<Index>
+        ]
+    );
+};
+/* ************************************************************************** */
+
+
+
+// ========================================================================== //
+} // namespace std
+#endif // _PACK_EXPRESSION_HPP_INCLUDED
+// ========================================================================== //
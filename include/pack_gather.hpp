@@ -0,0 +1,133 @@
+// =============================== PACK GATHER ============================== //
+// Project:         Pack
+// Name:            pack_gather.hpp
+// Description:     Selection of pack elements at arbitrary indices
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_GATHER_HPP_INCLUDED
+#define _PACK_GATHER_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "type_pack.hpp"
+#include "nontype_pack.hpp"
+#include "reference_pack.hpp"
+#include "pack_tuple.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ******************************* PACK GATHER ****************************** */
+// Pack gather structure declaration
+template <class, class>
+struct pack_gather;
+
+// Pack gather structure specialization: type pack
+template <class... Types, std::size_t... Indices>
+struct pack_gather<type_pack<Types...>, pack_index_sequence<Indices...>>
+{
+    using type = type_pack<
+        typename decltype(
+            std::declval<type_pack<Types...>>()[pack_index<Indices>{}]
+        )::type...
+    >;
+};
+
+// Pack gather structure specialization: non-type pack
+template <auto... Nontypes, std::size_t... Indices>
+struct pack_gather<nontype_pack<Nontypes...>, pack_index_sequence<Indices...>>
+{
+    using type = nontype_pack<
+        decltype(
+            std::declval<nontype_pack<Nontypes...>>()[pack_index<Indices>{}]
+        )::value...
+    >;
+};
+
+// Alias template
+template <class Pack, class Indices>
+using gather_t = typename pack_gather<Pack, Indices>::type;
+/* ************************************************************************** */
+
+
+
+/* ******************************* PACK SLICE ******************************* */
+// Pack slice structure definition for the half-open range [First, Last)
+template <class Pack, std::size_t First, std::size_t Last>
+struct pack_slice
+: pack_gather<Pack, make_pack_index_range<First, Last>>
+{
+};
+
+// Alias template
+template <class Pack, std::size_t First, std::size_t Last>
+using slice_t = typename pack_slice<Pack, First, Last>::type;
+/* ************************************************************************** */
+
+
+
+/* ********************************* GATHER ********************************* */
+// Gather declaration
+template <class Pack, std::size_t... Indices>
+constexpr auto gather(Pack&&, pack_index_sequence<Indices...>);
+/* ************************************************************************** */
+
+
+
+/* ********************************** SLICE ********************************* */
+// Slice declaration
+template <std::size_t First, std::size_t Last, class Pack>
+constexpr auto slice(Pack&&);
+/* ************************************************************************** */
+
+
+
+// --------------------------------- GATHER --------------------------------- //
+// Views the elements of a pack or a tuple at given indices as a reference pack
+template <class Pack, std::size_t... Indices>
+constexpr auto gather(
+    Pack&& pack,
+    pack_index_sequence<Indices...> indices
+)
+{
+    return pck::apply([](auto&&... elements) {
+        return reference_pack<decltype(elements)...>(
+            std::forward<decltype(elements)>(elements)...
+        );
+    }, std::forward<Pack>(pack), indices);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------- SLICE --------------------------------- //
+// Views the elements of a pack or a tuple in [First, Last) as a reference pack
+template <std::size_t First, std::size_t Last, class Pack>
+constexpr auto slice(
+    Pack&& pack
+)
+{
+    return pck::gather(
+        std::forward<Pack>(pack),
+        make_pack_index_range<First, Last>{}
+    );
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _PACK_GATHER_HPP_INCLUDED
+// ========================================================================== //
@@ -113,6 +113,106 @@ inline constexpr auto make_pack_index_sequence_v = make_pack_index_sequence<
 
 
 
+/* ************************* MAKE PACK INDEX RANGE ************************** */
+// Pack index range maker structure declaration
+template <std::size_t, class>
+struct pack_index_range_maker;
+
+// Pack index range maker structure specialization
+template <std::size_t First, std::size_t... Values>
+struct pack_index_range_maker<
+    First,
+    std::integer_sequence<std::size_t, Values...>
+>
+{
+    using type = pack_index_sequence<(First + Values)...>;
+};
+
+// Alias template maker for the half-open range [First, Last)
+template <std::size_t First, std::size_t Last>
+using make_pack_index_range = typename pack_index_range_maker<
+    First,
+    std::make_index_sequence<Last - First>
+>::type;
+
+// Variable template maker for the half-open range [First, Last)
+template <std::size_t First, std::size_t Last>
+inline constexpr auto make_pack_index_range_v = make_pack_index_range<
+    First,
+    Last
+>{};
+/* ************************************************************************** */
+
+
+
+/* **************************** PACK INDEX TABLE **************************** */
+// Pack index entry structure definition: a type at an index
+template <std::size_t Index, class Type>
+struct pack_index_entry
+{
+    using type = Type;
+};
+
+// Pack index table structure declaration
+template <class, class...>
+struct pack_index_table;
+
+// Pack index table structure specialization: one base per entry
+template <std::size_t... Indices, class... Types>
+struct pack_index_table<pack_index_sequence<Indices...>, Types...>
+: pack_index_entry<Indices, Types>...
+{
+};
+
+// Pack index lookup declaration: unevaluated contexts only
+template <std::size_t Index, class Type>
+pack_index_entry<Index, Type> pack_index_lookup(
+    const pack_index_entry<Index, Type>*
+);
+
+// Alias template: the type at an index, deduced from a single base
+template <std::size_t Index, class... Types>
+using pack_index_lookup_t = typename decltype(
+    pack_index_lookup<Index>(
+        static_cast<const pack_index_table<
+            make_pack_index_sequence<sizeof...(Types)>,
+            Types...
+        >*>(nullptr)
+    )
+)::type;
+/* ************************************************************************** */
+
+
+
+/* ***************************** PACK KEY TABLE ***************************** */
+// Pack key entry structure definition: a key at an index
+template <std::size_t Index, class Key>
+struct pack_key_entry
+{
+    static pack_index<Index> find(const Key&);
+};
+
+// Pack key table structure declaration
+template <class, class, class...>
+struct pack_key_table;
+
+// Pack key table structure specialization: the index of the key selected by
+// overload resolution for the argument, as when elements exposed their access
+// operators; its using-declaration being quadratic to compile, it should only
+// be instantiated for the keys that do not exactly name an element
+template <class Arg, std::size_t... Indices, class... Keys>
+struct pack_key_table<Arg, pack_index_sequence<Indices...>, Keys...>
+: pack_key_entry<Indices, Keys>...
+{
+    using pack_key_entry<Indices, Keys>::find...;
+    static constexpr std::size_t value = decltype(
+        find(std::declval<Arg>())
+    )::value;
+};
+/* ************************************************************************** */
+
+
+
 // -------------------------- PACK INDEX: LIFECYCLE ------------------------- //
 // Implicitly constructs a pack index from an integral constant
 template <std::size_t Value>
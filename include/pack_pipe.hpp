@@ -0,0 +1,336 @@
+// =============================== PACK PIPE ================================ //
+// Project:         Pack
+// Name:            pack_pipe.hpp
+// Description:     Fused lazy pipelines of type pack transformations
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_PIPE_HPP_INCLUDED
+#define _PACK_PIPE_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "empty_pack.hpp"
+#include "type_pack.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ******************************* PIPE STEPS ******************************* */
+// Pipe filter step: keeps the types for which the predicate value is true
+template <template <class> class Predicate>
+struct pipe_filter
+{
+};
+
+// Pipe transform step: replaces each type by the type of the function
+template <template <class> class Function>
+struct pipe_transform
+{
+};
+
+// Pipe unique step: keeps the first occurrence of each type
+struct pipe_unique
+{
+};
+/* ************************************************************************** */
+
+
+
+/* ***************************** PIPE REJECTION ***************************** */
+// Pipe rejection structure definition: an element discarded by a filter
+struct pipe_rejection
+{
+    // Types
+    using type = void;
+
+    // Traversal
+    static constexpr const void* id(std::size_t) noexcept;
+    static constexpr bool alive(std::size_t) noexcept;
+};
+/* ************************************************************************** */
+
+
+
+/* ****************************** PIPE ELEMENT ****************************** */
+// Pipe element structure definition: the path of a type through the steps
+template <class Type, class... Steps>
+struct pipe_element;
+
+// Pipe element structure specialization: end of the steps
+template <class Type>
+struct pipe_element<Type>
+{
+    // Types
+    using type = Type;
+
+    // Traversal
+    static constexpr const void* id(std::size_t) noexcept;
+    static constexpr bool alive(std::size_t) noexcept;
+};
+
+// Pipe element structure specialization: filter step
+template <class Type, template <class> class Predicate, class... Steps>
+struct pipe_element<Type, pipe_filter<Predicate>, Steps...>
+{
+    // Implementation details: next step, not instantiated when discarded
+    private:
+    using _next = std::conditional_t<
+        bool(Predicate<Type>::value),
+        pipe_element<Type, Steps...>,
+        pipe_rejection
+    >;
+
+    // Types
+    public:
+    using type = typename _next::type;
+
+    // Traversal
+    public:
+    static constexpr const void* id(std::size_t) noexcept;
+    static constexpr bool alive(std::size_t) noexcept;
+};
+
+// Pipe element structure specialization: transform step
+template <class Type, template <class> class Function, class... Steps>
+struct pipe_element<Type, pipe_transform<Function>, Steps...>
+{
+    // Implementation details: next step
+    private:
+    using _next = pipe_element<typename Function<Type>::type, Steps...>;
+
+    // Types
+    public:
+    using type = typename _next::type;
+
+    // Traversal
+    public:
+    static constexpr const void* id(std::size_t) noexcept;
+    static constexpr bool alive(std::size_t) noexcept;
+};
+
+// Pipe element structure specialization: unique step
+template <class Type, class... Steps>
+struct pipe_element<Type, pipe_unique, Steps...>
+{
+    // Implementation details: next step
+    private:
+    using _next = pipe_element<Type, Steps...>;
+
+    // Types
+    public:
+    using type = typename _next::type;
+
+    // Traversal
+    public:
+    static constexpr const void* id(std::size_t) noexcept;
+    static constexpr bool alive(std::size_t) noexcept;
+};
+/* ************************************************************************** */
+
+
+
+/* ********************************** PIPE ********************************** */
+// Pipe structure declaration
+template <class Pack, class... Steps>
+struct pipe;
+
+// Pipe structure specialization: empty pack
+template <class... Steps>
+struct pipe<empty_pack, Steps...>
+{
+    using type = empty_pack;
+};
+
+// Pipe structure specialization: type pack
+template <class... Types, class... Steps>
+struct pipe<type_pack<Types...>, Steps...>
+{
+    // Implementation details: plan of the kept elements
+    private:
+    struct _plan_type {
+        std::array<std::size_t, sizeof...(Types)> indices;
+        std::size_t size;
+    };
+    static constexpr _plan_type _make_plan() noexcept;
+    static constexpr _plan_type _plan = _make_plan();
+
+    // Implementation details: materialization
+    private:
+    template <std::size_t Index>
+    using _element_t = pipe_element<
+        pack_index_lookup_t<Index, Types...>,
+        Steps...
+    >;
+    static constexpr auto _type(pack_index_sequence<>) -> empty_pack;
+    template <std::size_t... Indices>
+    static constexpr auto _type(pack_index_sequence<Indices...>)
+    -> type_pack<typename _element_t<_plan.indices[Indices]>::type...>;
+
+    // Types
+    public:
+    using type = decltype(_type(make_pack_index_sequence<_plan.size>{}));
+};
+
+// Alias template
+template <class Pack, class... Steps>
+using pipe_t = typename pipe<Pack, Steps...>::type;
+/* ************************************************************************** */
+
+
+
+// ----------------------- PIPE REJECTION: TRAVERSAL ------------------------ //
+// Returns no identifier, the element being discarded
+constexpr const void* pipe_rejection::id(
+    std::size_t
+) noexcept
+{
+    return nullptr;
+}
+
+// Returns false, the element being discarded
+constexpr bool pipe_rejection::alive(
+    std::size_t
+) noexcept
+{
+    return false;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ PIPE ELEMENT: TRAVERSAL ------------------------- //
+// Returns the identifier of the type before the step: end of the steps
+template <class Type>
+constexpr const void* pipe_element<Type>::id(
+    std::size_t
+) noexcept
+{
+    return &type_tag<Type>;
+}
+
+// Returns whether the type reaches the step: end of the steps
+template <class Type>
+constexpr bool pipe_element<Type>::alive(
+    std::size_t
+) noexcept
+{
+    return true;
+}
+
+// Returns the identifier of the type before the step: filter step
+template <class Type, template <class> class Predicate, class... Steps>
+constexpr const void* pipe_element<Type, pipe_filter<Predicate>, Steps...>::id(
+    std::size_t step
+) noexcept
+{
+    return step == 0 ? &type_tag<Type> : _next::id(step - 1);
+}
+
+// Returns whether the type reaches the step: filter step
+template <class Type, template <class> class Predicate, class... Steps>
+constexpr bool pipe_element<Type, pipe_filter<Predicate>, Steps...>::alive(
+    std::size_t step
+) noexcept
+{
+    return step == 0 || _next::alive(step - 1);
+}
+
+// Returns the identifier of the type before the step: transform step
+template <class Type, template <class> class Function, class... Steps>
+constexpr const void* pipe_element<
+    Type,
+    pipe_transform<Function>,
+    Steps...
+>::id(
+    std::size_t step
+) noexcept
+{
+    return step == 0 ? &type_tag<Type> : _next::id(step - 1);
+}
+
+// Returns whether the type reaches the step: transform step
+template <class Type, template <class> class Function, class... Steps>
+constexpr bool pipe_element<Type, pipe_transform<Function>, Steps...>::alive(
+    std::size_t step
+) noexcept
+{
+    return step == 0 || _next::alive(step - 1);
+}
+
+// Returns the identifier of the type before the step: unique step
+template <class Type, class... Steps>
+constexpr const void* pipe_element<Type, pipe_unique, Steps...>::id(
+    std::size_t step
+) noexcept
+{
+    return step == 0 ? &type_tag<Type> : _next::id(step - 1);
+}
+
+// Returns whether the type reaches the step: unique step
+template <class Type, class... Steps>
+constexpr bool pipe_element<Type, pipe_unique, Steps...>::alive(
+    std::size_t step
+) noexcept
+{
+    return step == 0 || _next::alive(step - 1);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- PIPE: IMPLEMENTATION DETAILS ---------------------- //
+// Computes once the indices of the elements that go through all the steps,
+// in built-in arrays as constant evaluation caches every call to the
+// subscript operator of standard arrays
+template <class... Types, class... Steps>
+constexpr typename pipe<type_pack<Types...>, Steps...>::_plan_type
+pipe<type_pack<Types...>, Steps...>::_make_plan(
+) noexcept
+{
+    constexpr std::size_t size = sizeof...(Types);
+    constexpr std::size_t steps = sizeof...(Steps);
+    constexpr bool unique[steps + 1] = {
+        std::is_same_v<Steps, pipe_unique>..., false
+    };
+    bool kept[size] = {pipe_element<Types, Steps...>::alive(0)...};
+    _plan_type plan = {};
+    for (std::size_t step = 0; step <= steps; ++step) {
+        const bool alive[size] = {
+            pipe_element<Types, Steps...>::alive(step)...
+        };
+        const void* const ids[size] = {
+            pipe_element<Types, Steps...>::id(step)...
+        };
+        for (std::size_t i = 0; i < size; ++i) {
+            kept[i] = kept[i] && alive[i];
+            for (std::size_t j = 0; unique[step] && kept[i] && j < i; ++j) {
+                kept[i] = !(kept[j] && ids[j] == ids[i]);
+            }
+        }
+    }
+    for (std::size_t i = 0; i < size; ++i) {
+        if (kept[i]) {
+            plan.indices[plan.size++] = i;
+        }
+    }
+    return plan;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _PACK_PIPE_HPP_INCLUDED
+// ========================================================================== //
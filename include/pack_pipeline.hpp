@@ -0,0 +1,535 @@
+// ============================= PACK PIPELINE ============================== //
+// Project:         Pack
+// Name:            pack_pipeline.hpp
+// Description:     Streaming pipelines of stages running on their own threads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_PIPELINE_HPP_INCLUDED
+#define _PACK_PIPELINE_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <exception>
+#include <functional>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "type_pack.hpp"
+#include "object_pack.hpp"
+#include "spsc_queue.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ******************************* REPLICATED ******************************* */
+// Replicated structure definition: a stage run by several threads
+template <class Stage, std::size_t Replicas>
+struct replicated
+{
+};
+/* ************************************************************************** */
+
+
+
+/* ***************************** PIPELINE STAGE ***************************** */
+// Pipeline stage structure definition: a function object on its own thread
+template <class Stage>
+struct pipeline_stage
+{
+    // Types and constants
+    using type = Stage;
+    using input_type = typename Stage::input_type;
+    using output_type = typename Stage::output_type;
+    static constexpr std::size_t replicas = 1;
+
+    // Checks
+    static_assert(!std::is_void_v<input_type>, "stages should have an input");
+    static_assert(
+        std::is_invocable_r_v<output_type, Stage&, input_type&&>,
+        "stages should turn their input into their output"
+    );
+};
+
+// Pipeline stage structure specialization: replicated stage
+template <class Stage, std::size_t Replicas>
+struct pipeline_stage<replicated<Stage, Replicas>>
+: pipeline_stage<Stage>
+{
+    // Constants
+    static constexpr std::size_t replicas = Replicas;
+
+    // Checks
+    static_assert(Replicas > 0, "stages should have at least one replica");
+};
+/* ************************************************************************** */
+
+
+
+/* ******************************** PIPELINE ******************************** */
+// Pipeline class declaration
+template <class Stages, std::size_t Batch = 64, std::size_t Capacity = 1024>
+class pipeline;
+
+// Pipeline class definition: stages connected by ring buffers of blocks
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+class pipeline<type_pack<Stages...>, Batch, Capacity>
+{
+    // Implementation details: stages
+    private:
+    static constexpr std::size_t _size = sizeof...(Stages);
+    static constexpr std::array<std::size_t, _size + 2> _replicas = {
+        1, pipeline_stage<Stages>::replicas..., 1
+    };
+    template <std::size_t Index>
+    using _stage_t = pipeline_stage<pack_index_lookup_t<Index, Stages...>>;
+
+    // Types
+    public:
+    using size_type = std::size_t;
+    using input_type = typename _stage_t<0>::input_type;
+    using output_type = typename _stage_t<_size - 1>::output_type;
+
+    // Checks
+    static_assert(
+        std::is_same_v<
+            type_pack<
+                input_type,
+                typename pipeline_stage<Stages>::output_type...
+            >,
+            type_pack<
+                typename pipeline_stage<Stages>::input_type...,
+                output_type
+            >
+        >,
+        "each stage should output the input of the next stage"
+    );
+    static_assert(Batch > 0, "blocks should not be empty");
+    static_assert(Capacity >= Batch, "queues should hold at least a block");
+
+    // Lifecycle
+    public:
+    pipeline();
+    explicit pipeline(const typename pipeline_stage<Stages>::type&...);
+    pipeline(const pipeline&) = delete;
+    pipeline& operator=(const pipeline&) = delete;
+
+    // Run
+    public:
+    template <class InputIt, class OutputIt>
+    OutputIt run(InputIt, InputIt, OutputIt);
+    template <class InputIt>
+    void run(InputIt, InputIt);
+
+    // Size
+    public:
+    static constexpr size_type size() noexcept;
+    static constexpr size_type replicas(size_type) noexcept;
+
+    // Implementation details: queues, left unallocated for void outputs
+    private:
+    template <class Message>
+    using _buffer_t = std::vector<
+        std::conditional_t<std::is_void_v<Message>, char, Message>
+    >;
+    template <class Message>
+    using _queues_t = std::unique_ptr<
+        spsc_queue<typename _buffer_t<Message>::value_type, Capacity>[]
+    >;
+    template <std::size_t Boundary>
+    void _open();
+    template <class Queue, class Buffer>
+    void _pop_block(Queue&, Buffer&);
+    template <class Queue, class Buffer>
+    void _push_block(Queue&, Buffer&);
+    static void _wait(size_type&);
+
+    // Implementation details: threads
+    private:
+    template <std::size_t... Indices>
+    void _launch(std::vector<std::thread>&, pack_index_sequence<Indices...>);
+    template <std::size_t Index>
+    void _work(size_type);
+    template <class InputIt, class Sink, std::size_t... Boundaries>
+    void _run(InputIt, InputIt, Sink&&, pack_index_sequence<Boundaries...>);
+    void _fail() noexcept;
+
+    // Implementation details: constants
+    private:
+    static constexpr size_type _spins = 64;
+
+    // Implementation details: data members
+    private:
+    object_pack<std::vector<typename pipeline_stage<Stages>::type>...> _stages;
+    object_pack<
+        _queues_t<input_type>,
+        _queues_t<typename pipeline_stage<Stages>::output_type>...
+    > _queues;
+    std::exception_ptr _exception;
+    std::atomic<bool> _is_failed;
+};
+/* ************************************************************************** */
+
+
+
+// -------------------------- PIPELINE: LIFECYCLE --------------------------- //
+// Constructs the pipeline with default constructed stages
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+pipeline<type_pack<Stages...>, Batch, Capacity>::pipeline(
+)
+: _stages(
+    std::vector<typename pipeline_stage<Stages>::type>(
+        pipeline_stage<Stages>::replicas
+    )...
+)
+, _queues()
+, _exception()
+, _is_failed(false)
+{
+}
+
+// Constructs the pipeline with copies of the stages for each replica
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+pipeline<type_pack<Stages...>, Batch, Capacity>::pipeline(
+    const typename pipeline_stage<Stages>::type&... stages
+)
+: _stages(
+    std::vector<typename pipeline_stage<Stages>::type>(
+        pipeline_stage<Stages>::replicas,
+        stages
+    )...
+)
+, _queues()
+, _exception()
+, _is_failed(false)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------------- PIPELINE: RUN ------------------------------ //
+// Streams the inputs through the stages and writes the outputs in order: if a
+// stage, the copy of an input, or the writing of an output throws, the stream
+// stops, and the first exception thrown is rethrown once the threads are done
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+template <class InputIt, class OutputIt>
+OutputIt pipeline<type_pack<Stages...>, Batch, Capacity>::run(
+    InputIt first,
+    InputIt last,
+    OutputIt out
+)
+{
+    static_assert(!std::is_void_v<output_type>, "no output to write");
+    _run(
+        first,
+        last,
+        [&out](output_type&& value) {*out++ = std::move(value);},
+        make_pack_index_sequence<_size + 1>{}
+    );
+    return out;
+}
+
+// Streams the inputs through stages whose last one outputs nothing, stopping
+// and rethrowing as above on exceptions
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+template <class InputIt>
+void pipeline<type_pack<Stages...>, Batch, Capacity>::run(
+    InputIt first,
+    InputIt last
+)
+{
+    static_assert(std::is_void_v<output_type>, "outputs should be written");
+    _run(first, last, [](char) {}, make_pack_index_sequence<_size + 1>{});
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------------- PIPELINE: SIZE ----------------------------- //
+// Returns the number of stages
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+constexpr typename pipeline<type_pack<Stages...>, Batch, Capacity>::size_type
+pipeline<type_pack<Stages...>, Batch, Capacity>::size(
+) noexcept
+{
+    return _size;
+}
+
+// Returns the number of threads running the stage at the given index
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+constexpr typename pipeline<type_pack<Stages...>, Batch, Capacity>::size_type
+pipeline<type_pack<Stages...>, Batch, Capacity>::replicas(
+    size_type stage
+) noexcept
+{
+    return _replicas[stage + 1];
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- PIPELINE: IMPLEMENTATION DETAILS -------------------- //
+// Allocates fresh queues from each replica to each replica of the next stage
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+template <std::size_t Boundary>
+void pipeline<type_pack<Stages...>, Batch, Capacity>::_open(
+)
+{
+    using queues_type = std::decay_t<decltype(get<Boundary>(_queues))>;
+    using queue_type = typename queues_type::element_type;
+    constexpr bool is_void = Boundary == _size && std::is_void_v<output_type>;
+    constexpr size_type size = _replicas[Boundary] * _replicas[Boundary + 1];
+    if constexpr (!is_void) {
+        get<Boundary>(_queues) = std::make_unique<queue_type[]>(size);
+    }
+}
+
+// Pops a block from a queue, only stopping early at the end of the stream, or
+// with an empty block once the pipeline failed
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+template <class Queue, class Buffer>
+void pipeline<type_pack<Stages...>, Batch, Capacity>::_pop_block(
+    Queue& queue,
+    Buffer& buffer
+)
+{
+    using value_type = typename Buffer::value_type;
+    const auto append = [&buffer](value_type&& value) {
+        buffer.push_back(std::move(value));
+    };
+    size_type attempts = 0;
+    buffer.clear();
+    while (buffer.size() < Batch) {
+        const bool is_closed = queue.is_closed();
+        if (_is_failed.load(std::memory_order_relaxed)) {
+            buffer.clear();
+            break;
+        } else if (queue.try_pop_n(append, Batch - buffer.size()) != 0) {
+            attempts = 0;
+        } else if (is_closed) {
+            break;
+        } else {
+            _wait(attempts);
+        }
+    }
+}
+
+// Pushes a block to a queue, waiting while the next stage lags behind, unless
+// the pipeline failed
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+template <class Queue, class Buffer>
+void pipeline<type_pack<Stages...>, Batch, Capacity>::_push_block(
+    Queue& queue,
+    Buffer& buffer
+)
+{
+    size_type attempts = 0;
+    auto first = buffer.begin();
+    const auto last = buffer.end();
+    while (first != last && !_is_failed.load(std::memory_order_relaxed)) {
+        const auto next = queue.try_push_n(first, last);
+        if (next != first) {
+            attempts = 0;
+        } else {
+            _wait(attempts);
+        }
+        first = next;
+    }
+}
+
+// Waits for the other threads, spinning first then yielding the core
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+void pipeline<type_pack<Stages...>, Batch, Capacity>::_wait(
+    size_type& attempts
+)
+{
+    if (++attempts > _spins) {
+        std::this_thread::yield();
+    }
+}
+
+// Starts one thread per replica of each stage
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+template <std::size_t... Indices>
+void pipeline<type_pack<Stages...>, Batch, Capacity>::_launch(
+    std::vector<std::thread>& threads,
+    pack_index_sequence<Indices...>
+)
+{
+    using worker_type = void (pipeline::*)(size_type);
+    constexpr std::array<worker_type, _size> workers = {
+        &pipeline::template _work<Indices>...
+    };
+    for (size_type stage = 0; stage < _size; ++stage) {
+        for (size_type replica = 0; replica < replicas(stage); ++replica) {
+            threads.emplace_back(workers[stage], this, replica);
+        }
+    }
+}
+
+// Runs a replica: block b goes from replica b % n of a stage to the next one,
+// until the end of the stream or a failure, and then closes its outputs
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+template <std::size_t Index>
+void pipeline<type_pack<Stages...>, Batch, Capacity>::_work(
+    size_type replica
+)
+{
+    using input = typename _stage_t<Index>::input_type;
+    using output = typename _stage_t<Index>::output_type;
+    constexpr size_type upstream = _replicas[Index];
+    constexpr size_type replicas = _replicas[Index + 1];
+    constexpr size_type downstream = _replicas[Index + 2];
+    auto& stage = get<Index>(_stages)[replica];
+    auto* inputs = get<Index>(_queues).get();
+    auto* outputs = get<Index + 1>(_queues).get();
+    _buffer_t<input> received;
+    _buffer_t<output> results;
+    received.reserve(Batch);
+    results.reserve(Batch);
+    size_type block = replica;
+    try {
+        do {
+            _pop_block(inputs[block % upstream * replicas + replica], received);
+            if constexpr (std::is_void_v<output>) {
+                for (input& message : received) {
+                    std::invoke(stage, std::move(message));
+                }
+            } else {
+                results.clear();
+                for (input& message : received) {
+                    results.push_back(std::invoke(stage, std::move(message)));
+                }
+                const size_type target = replica * downstream
+                                       + block % downstream;
+                _push_block(outputs[target], results);
+            }
+            block += replicas;
+        } while (received.size() == Batch);
+    } catch (...) {
+        _fail();
+    }
+    if constexpr (!std::is_void_v<output>) {
+        for (size_type next = 0; next < downstream; ++next) {
+            outputs[replica * downstream + next].close();
+        }
+    }
+}
+
+// Feeds the first stage and drains the last one on the calling thread
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+template <class InputIt, class Sink, std::size_t... Boundaries>
+void pipeline<type_pack<Stages...>, Batch, Capacity>::_run(
+    InputIt first,
+    InputIt last,
+    Sink&& sink,
+    pack_index_sequence<Boundaries...>
+)
+{
+    constexpr size_type sources = _replicas[1];
+    constexpr size_type sinks = _replicas[_size];
+    std::vector<std::thread> threads;
+    std::vector<input_type> pending;
+    size_type source = 0;
+    size_type drained = 0;
+    size_type count = 0;
+    size_type attempts = 0;
+    bool is_feeding = true;
+    bool is_draining = !std::is_void_v<output_type>;
+    (_open<Boundaries>(), ...);
+    _is_failed.store(false, std::memory_order_relaxed);
+    try {
+        _launch(threads, make_pack_index_sequence<_size>{});
+        pending.reserve(Batch);
+        for (; first != last && pending.size() < Batch; ++first) {
+            pending.push_back(*first);
+        }
+        auto next = pending.begin();
+        while (
+            (is_feeding || is_draining)
+            && !_is_failed.load(std::memory_order_relaxed)
+        ) {
+            bool is_progressing = false;
+            if (is_feeding) {
+                auto& queue = get<0>(_queues)[source % sources];
+                const auto pushed = queue.try_push_n(next, pending.end());
+                is_progressing = pushed != next;
+                next = pushed;
+            }
+            if (is_feeding && next == pending.end()) {
+                if (pending.size() < Batch) {
+                    for (size_type replica = 0; replica < sources; ++replica) {
+                        get<0>(_queues)[replica].close();
+                    }
+                    is_feeding = false;
+                } else {
+                    pending.clear();
+                    for (; first != last && pending.size() < Batch; ++first) {
+                        pending.push_back(*first);
+                    }
+                    next = pending.begin();
+                    ++source;
+                }
+            }
+            if (is_draining) {
+                auto& queue = get<_size>(_queues)[drained % sinks];
+                const bool is_closed = queue.is_closed();
+                const size_type popped = queue.try_pop_n(sink, Batch - count);
+                is_progressing = is_progressing || popped != 0;
+                count += popped;
+                if (count == Batch) {
+                    ++drained;
+                    count = 0;
+                } else if (popped == 0 && is_closed) {
+                    is_draining = false;
+                }
+            }
+            if (is_progressing) {
+                attempts = 0;
+            } else {
+                _wait(attempts);
+            }
+        }
+    } catch (...) {
+        _fail();
+    }
+    for (size_type replica = 0; replica < sources; ++replica) {
+        get<0>(_queues)[replica].close();
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    if (_is_failed.load(std::memory_order_relaxed)) {
+        std::rethrow_exception(std::exchange(_exception, nullptr));
+    }
+}
+
+// Records the first exception thrown, and makes every thread stop
+template <class... Stages, std::size_t Batch, std::size_t Capacity>
+void pipeline<type_pack<Stages...>, Batch, Capacity>::_fail(
+) noexcept
+{
+    if (!_is_failed.exchange(true, std::memory_order_acq_rel)) {
+        _exception = std::current_exception();
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _PACK_PIPELINE_HPP_INCLUDED
+// ========================================================================== //
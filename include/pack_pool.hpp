@@ -0,0 +1,362 @@
+// =============================== PACK POOL ================================ //
+// Project:         Pack
+// Name:            pack_pool.hpp
+// Description:     Segregated free lists of the types of a pack
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_POOL_HPP_INCLUDED
+#define _PACK_POOL_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <new>
+#include <array>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+// Project sources
+#include "pack_details.hpp"
+#include "type_pack.hpp"
+#include "pack_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ******************************* PACK POOL ******************************** */
+// Pack pool class declaration
+template <class Types>
+class pack_pool;
+
+// Pack pool class definition: a slab-backed free list for each type
+template <class... Types>
+class pack_pool<type_pack<Types...>>
+{
+    // Types
+    public:
+    using size_type = std::size_t;
+
+    // Lifecycle
+    public:
+    pack_pool();
+    pack_pool(const pack_pool&) = delete;
+    pack_pool& operator=(const pack_pool&) = delete;
+
+    // Allocation
+    public:
+    template <class Type>
+    Type* allocate();
+    template <class Type>
+    void deallocate(Type*) noexcept;
+
+    // Construction
+    public:
+    template <class Type, class... Args>
+    Type* create(Args&&...);
+    template <class Type>
+    void destroy(Type*) noexcept;
+
+    // Implementation details: blocks
+    private:
+    struct _block {
+        _block* next;
+    };
+    struct _free_list {
+        _block* head = nullptr;
+        std::size_t size = 0;
+    };
+    template <class Type>
+    static constexpr std::size_t _alignment_v = std::max(
+        alignof(Type),
+        alignof(_block)
+    );
+    template <class Type>
+    static constexpr std::size_t _block_size_v = (
+        std::max(sizeof(Type), sizeof(_block)) + _alignment_v<Type> - 1
+    ) / _alignment_v<Type> * _alignment_v<Type>;
+    static constexpr std::size_t _size = sizeof...(Types);
+    static constexpr std::array<std::size_t, _size> _alignments = {
+        _alignment_v<Types>...
+    };
+    static constexpr std::array<std::size_t, _size> _block_sizes = {
+        _block_size_v<Types>...
+    };
+    template <class Type>
+    static constexpr std::size_t _index() noexcept;
+
+    // Implementation details: central depot, shared by all the threads
+    private:
+    struct _depot {
+        std::mutex mutex;
+        _free_list list;
+        std::vector<void*> slabs;
+    };
+    struct _core {
+        _core() = default;
+        _core(const _core&) = delete;
+        _core& operator=(const _core&) = delete;
+        ~_core();
+        std::array<_depot, _size> depots;
+    };
+    static void _take(_core&, std::size_t, _free_list&);
+    static void _give(_core&, std::size_t, _free_list&, std::size_t) noexcept;
+
+    // Implementation details: thread-local caches, flushed on thread exit
+    private:
+    struct _cache {
+        std::shared_ptr<_core> core;
+        std::array<_free_list, _size> lists;
+    };
+    struct _cache_table {
+        _cache_table() = default;
+        _cache_table(const _cache_table&) = delete;
+        _cache_table& operator=(const _cache_table&) = delete;
+        ~_cache_table();
+        std::array<_cache, 4> caches;
+        std::size_t next = 0;
+    };
+    _cache& _local();
+    static void _flush(_cache&) noexcept;
+
+    // Implementation details: constants
+    private:
+    static constexpr std::size_t _batch = 32;
+    static constexpr std::size_t _slab_blocks = 256;
+
+    // Implementation details: data members
+    private:
+    inline static thread_local _cache_table _table;
+    std::shared_ptr<_core> _core_pointer;
+};
+/* ************************************************************************** */
+
+
+
+// -------------------------- PACK POOL: LIFECYCLE -------------------------- //
+// Constructs a pool without slabs: the threads still caching blocks keep
+// the slabs alive after the destruction of the pool
+template <class... Types>
+pack_pool<type_pack<Types...>>::pack_pool(
+)
+: _core_pointer(std::make_shared<_core>())
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- PACK POOL: ALLOCATION -------------------------- //
+// Pops a block from the cache of the thread, refilled from the depot
+template <class... Types>
+template <class Type>
+Type* pack_pool<type_pack<Types...>>::allocate(
+)
+{
+    constexpr std::size_t index = _index<Type>();
+    _free_list& list = _local().lists[index];
+    if (!list.head) {
+        _take(*_core_pointer, index, list);
+    }
+    _block* block = list.head;
+    list.head = block->next;
+    --list.size;
+    return static_cast<Type*>(static_cast<void*>(block));
+}
+
+// Pushes a block to the cache of the thread, its excess going to the depot
+template <class... Types>
+template <class Type>
+void pack_pool<type_pack<Types...>>::deallocate(
+    Type* pointer
+) noexcept
+{
+    constexpr std::size_t index = _index<Type>();
+    _free_list& list = _local().lists[index];
+    list.head = ::new (static_cast<void*>(pointer)) _block{list.head};
+    if (++list.size > 2 * _batch) {
+        _give(*_core_pointer, index, list, _batch);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ PACK POOL: CONSTRUCTION ------------------------- //
+// Allocates a block and constructs an object in it
+template <class... Types>
+template <class Type, class... Args>
+Type* pack_pool<type_pack<Types...>>::create(
+    Args&&... args
+)
+{
+    Type* pointer = allocate<Type>();
+    try {
+        ::new (static_cast<void*>(pointer)) Type(std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate(pointer);
+        throw;
+    }
+    return pointer;
+}
+
+// Destroys an object and deallocates its block
+template <class... Types>
+template <class Type>
+void pack_pool<type_pack<Types...>>::destroy(
+    Type* pointer
+) noexcept
+{
+    pointer->~Type();
+    deallocate(pointer);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- PACK POOL: IMPLEMENTATION DETAILS -------------------- //
+// Returns the index of the free lists of a type, resolved at compile time
+template <class... Types>
+template <class Type>
+constexpr std::size_t pack_pool<type_pack<Types...>>::_index(
+) noexcept
+{
+    constexpr std::size_t index = type_id_table<Types...>::find(
+        &type_tag<Type>
+    );
+    static_assert(index < _size, "the type should be one of the pool");
+    return index;
+}
+
+// Releases the slabs once the pool and all the caches are gone
+template <class... Types>
+pack_pool<type_pack<Types...>>::_core::~_core(
+)
+{
+    for (std::size_t i = 0; i < _size; ++i) {
+        for (void* slab : depots[i].slabs) {
+            ::operator delete(slab, std::align_val_t(_alignments[i]));
+        }
+    }
+}
+
+// Moves a batch from the depot to a free list, carving a slab if it is empty
+template <class... Types>
+void pack_pool<type_pack<Types...>>::_take(
+    _core& core,
+    std::size_t index,
+    _free_list& list
+)
+{
+    _depot& depot = core.depots[index];
+    const std::lock_guard<std::mutex> lock(depot.mutex);
+    if (depot.list.head) {
+        _block* last = depot.list.head;
+        std::size_t count = 1;
+        for (; count < _batch && last->next; ++count) {
+            last = last->next;
+        }
+        list.head = std::exchange(depot.list.head, last->next);
+        list.size = count;
+        depot.list.size -= count;
+        last->next = nullptr;
+    } else {
+        const std::size_t size = _block_sizes[index];
+        depot.slabs.reserve(depot.slabs.size() + 1);
+        std::byte* slab = static_cast<std::byte*>(::operator new(
+            size * _slab_blocks,
+            std::align_val_t(_alignments[index])
+        ));
+        depot.slabs.push_back(slab);
+        for (std::size_t i = _slab_blocks; i > 0; --i) {
+            _free_list& target = i > _batch ? depot.list : list;
+            target.head = ::new (slab + (i - 1) * size) _block{target.head};
+        }
+        list.size = _batch;
+        depot.list.size = _slab_blocks - _batch;
+    }
+}
+
+// Moves the given number of blocks from a free list to the depot
+template <class... Types>
+void pack_pool<type_pack<Types...>>::_give(
+    _core& core,
+    std::size_t index,
+    _free_list& list,
+    std::size_t count
+) noexcept
+{
+    _depot& depot = core.depots[index];
+    _block* first = list.head;
+    _block* last = first;
+    for (std::size_t i = 1; i < count; ++i) {
+        last = last->next;
+    }
+    list.head = last->next;
+    list.size -= count;
+    const std::lock_guard<std::mutex> lock(depot.mutex);
+    last->next = depot.list.head;
+    depot.list.head = first;
+    depot.list.size += count;
+}
+
+// Returns the cache of the thread for this pool, evicting another if needed
+template <class... Types>
+typename pack_pool<type_pack<Types...>>::_cache&
+pack_pool<type_pack<Types...>>::_local(
+)
+{
+    _cache_table& table = _table;
+    for (_cache& cache : table.caches) {
+        if (cache.core == _core_pointer) {
+            return cache;
+        }
+    }
+    _cache& cache = table.caches[table.next++ % table.caches.size()];
+    _flush(cache);
+    cache.core = _core_pointer;
+    return cache;
+}
+
+// Returns all the blocks of a cache to the depot, and forgets the pool
+template <class... Types>
+void pack_pool<type_pack<Types...>>::_flush(
+    _cache& cache
+) noexcept
+{
+    if (cache.core) {
+        for (std::size_t i = 0; i < _size; ++i) {
+            if (cache.lists[i].size != 0) {
+                _give(*cache.core, i, cache.lists[i], cache.lists[i].size);
+            }
+        }
+        cache.core.reset();
+    }
+}
+
+// Returns the blocks cached by an exiting thread to their depots
+template <class... Types>
+pack_pool<type_pack<Types...>>::_cache_table::~_cache_table(
+)
+{
+    for (_cache& cache : caches) {
+        _flush(cache);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _PACK_POOL_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,190 @@
+// =============================== PACK TUPLE =============================== //
+// Project:         Pack
+// Name:            pack_tuple.hpp
+// Description:     Interoperability between packs and tuples
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PACK_TUPLE_HPP_INCLUDED
+#define _PACK_TUPLE_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <tuple>
+#include <functional>
+#include <type_traits>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "object_pack.hpp"
+#include "reference_pack.hpp"
+#include "pack_aggregate.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ****************************** IS TUPLE LIKE ***************************** */
+// Is tuple like structure definition: false by default
+template <class Type, class = void>
+struct is_tuple_like
+: std::false_type
+{
+};
+
+// Is tuple like structure specialization: true when the size is defined
+template <class Type>
+struct is_tuple_like<Type, std::void_t<decltype(std::tuple_size<Type>::value)>>
+: std::true_type
+{
+};
+
+// Variable template
+template <class Type>
+inline constexpr bool is_tuple_like_v = is_tuple_like<Type>::value;
+/* ************************************************************************** */
+
+
+
+/* ********************************** APPLY ********************************* */
+// Apply overload set declaration
+template <class Function, class Pack>
+constexpr decltype(auto) apply(Function&&, Pack&&);
+template <class Function, class Pack, std::size_t... Indices>
+constexpr decltype(auto) apply(
+    Function&&,
+    Pack&&,
+    pack_index_sequence<Indices...>
+);
+/* ************************************************************************** */
+
+
+
+/* **************************** AS TUPLE OF REFS **************************** */
+// As tuple of references declaration
+template <class Pack>
+constexpr auto as_tuple_of_refs(Pack&&) noexcept;
+/* ************************************************************************** */
+
+
+
+/* **************************** AS REFERENCE PACK *************************** */
+// As reference pack declaration
+template <class Tuple>
+constexpr auto as_reference_pack(Tuple&&);
+/* ************************************************************************** */
+
+
+
+/* ***************************** TO OBJECT PACK ***************************** */
+// To object pack declaration
+template <class Tuple>
+constexpr auto to_object_pack(Tuple&&);
+/* ************************************************************************** */
+
+
+
+// --------------------------------- APPLY ---------------------------------- //
+// Invokes a function on all the elements of a pack or a tuple, or on all
+// the fields of an aggregate that is not tuple-like
+template <class Function, class Pack>
+constexpr decltype(auto) apply(
+    Function&& function,
+    Pack&& pack
+)
+{
+    using type = std::remove_cv_t<std::remove_reference_t<Pack>>;
+    if constexpr (is_tuple_like_v<type>) {
+        return pck::apply(
+            std::forward<Function>(function),
+            std::forward<Pack>(pack),
+            make_pack_index_sequence<std::tuple_size_v<type>>{}
+        );
+    } else {
+        return aggregate_apply(
+            std::forward<Function>(function),
+            std::forward<Pack>(pack)
+        );
+    }
+}
+
+// Invokes a function on the elements of a pack or a tuple at given indices
+template <class Function, class Pack, std::size_t... Indices>
+constexpr decltype(auto) apply(
+    Function&& function,
+    Pack&& pack,
+    pack_index_sequence<Indices...>
+)
+{
+    return std::invoke(
+        std::forward<Function>(function),
+        get<Indices>(std::forward<Pack>(pack))...
+    );
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- AS TUPLE OF REFS ---------------------------- //
+// Views the elements of a pack as a tuple of references preserving categories
+template <class Pack>
+constexpr auto as_tuple_of_refs(
+    Pack&& pack
+) noexcept
+{
+    return pck::apply([](auto&&... elements) noexcept {
+        return std::forward_as_tuple(
+            std::forward<decltype(elements)>(elements)...
+        );
+    }, std::forward<Pack>(pack));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- AS REFERENCE PACK ---------------------------- //
+// Views the elements of a tuple or the fields of an aggregate as a reference
+// pack preserving categories, without copying them
+template <class Tuple>
+constexpr auto as_reference_pack(
+    Tuple&& tuple
+)
+{
+    return pck::apply([](auto&&... elements) {
+        return reference_pack<decltype(elements)...>(
+            std::forward<decltype(elements)>(elements)...
+        );
+    }, std::forward<Tuple>(tuple));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------------- TO OBJECT PACK ----------------------------- //
+// Copies the elements of a tuple or the fields of an aggregate into an
+// object pack, moving them out of an rvalue
+template <class Tuple>
+constexpr auto to_object_pack(
+    Tuple&& tuple
+)
+{
+    return pck::apply([](auto&&... elements) {
+        return object_pack<std::decay_t<decltype(elements)>...>(
+            std::forward<decltype(elements)>(elements)...
+        );
+    }, std::forward<Tuple>(tuple));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _PACK_TUPLE_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,481 @@
+// =========================== PADDED OBJECT PACK =========================== //
+// Project:         Pack
+// Name:            padded_object_pack.hpp
+// Description:     A pack of objects each alone on its own cache lines
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _PADDED_OBJECT_PACK_HPP_INCLUDED
+#define _PADDED_OBJECT_PACK_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <tuple>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "object_pack.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+template <class Type, class Index, class Key = Type>
+class padded_object_pack_element;
+template <class, class...>
+class padded_object_pack_base;
+template <class... Types>
+class padded_object_pack;
+// ========================================================================== //
+
+
+
+/* *********************** PADDED OBJECT PACK ELEMENT *********************** */
+// Padded object pack element definition: an object pack element aligned on
+// and padded to cache lines, so that threads writing to different elements
+// never share a line; cache_line_size is used rather than the interference
+// size of the standard library, which varies with the compiler flags
+template <class Type, class Index, class Key>
+class alignas(std::max(cache_line_size, alignof(Type)))
+padded_object_pack_element
+: public object_pack_element<Type, Index, Key>
+{
+    // Lifecycle
+    public:
+    using object_pack_element<Type, Index, Key>::object_pack_element;
+};
+/* ************************************************************************** */
+
+
+
+/* ****************** IS OBJECT PACK CONSTRUCTIBLE: PADDED ****************** */
+// Is object pack constructible specialization: padded object pack base
+template <std::size_t... Indices, class... Types, class... Args>
+struct is_object_pack_constructible<
+    padded_object_pack_base<pack_index_sequence<Indices...>, Types...>,
+    Args...
+>
+: std::conjunction<
+    std::bool_constant<sizeof...(Types) == sizeof...(Args)>,
+    std::bool_constant<pack_conjunction_v<!std::is_base_of_v<
+        padded_object_pack_base<pack_index_sequence<Indices...>, Types...>,
+        std::remove_cv_t<std::remove_reference_t<Args>>
+    >...>>,
+    is_object_pack_constructible<
+        std::tuple<object_pack_element<Types, pack_index<Indices>>...>,
+        std::tuple<Args...>
+    >
+>
+{
+};
+
+// Is object pack constructible specialization: padded object pack
+template <class... Types, class... Args>
+struct is_object_pack_constructible<padded_object_pack<Types...>, Args...>
+: is_object_pack_constructible<
+    padded_object_pack_base<
+        make_pack_index_sequence<sizeof...(Types)>,
+        Types...
+    >,
+    Args...
+>
+{
+};
+/* ************************************************************************** */
+
+
+
+/* ************************ PADDED OBJECT PACK BASE ************************* */
+// Padded object pack base class specialization
+template <std::size_t... Indices, class... Types>
+class padded_object_pack_base<pack_index_sequence<Indices...>, Types...>
+: padded_object_pack_element<Types, pack_index<Indices>>...
+{
+    // Implementation details: type traits
+    private:
+    template <class... Args>
+    using _if_constructible_from_t = if_object_pack_constructible_t<
+        padded_object_pack_base,
+        Args...
+    >;
+    static constexpr bool _is_nothrow_default_constructible_v
+    = pack_conjunction_v<std::is_nothrow_default_constructible_v<Types>...>;
+    static constexpr bool _is_nothrow_copy_constructible_v
+    = pack_conjunction_v<std::is_nothrow_copy_constructible_v<Types>...>;
+    template <class... Args>
+    static constexpr bool _is_nothrow_constructible_from_v
+    = pack_conjunction_v<std::is_nothrow_constructible_v<Types, Args>...>;
+
+    // Lifecycle
+    public:
+    constexpr padded_object_pack_base() = default;
+    explicit constexpr padded_object_pack_base(
+        uninitialized_t
+    ) noexcept(_is_nothrow_default_constructible_v);
+    explicit constexpr padded_object_pack_base(
+        const Types&...
+    ) noexcept(_is_nothrow_copy_constructible_v);
+    template <class... Args, class = _if_constructible_from_t<Args&&...>>
+    explicit constexpr padded_object_pack_base(
+        Args&&...
+    ) noexcept(_is_nothrow_constructible_from_v<Args&&...>);
+
+    // Access
+    public:
+    template <std::size_t Index>
+    constexpr auto& operator[](pack_index<Index>) noexcept;
+    template <std::size_t Index>
+    constexpr const auto& operator[](pack_index<Index>) const noexcept;
+    template <class Key>
+    constexpr auto& operator[](Key&&) noexcept;
+    template <class Key>
+    constexpr const auto& operator[](Key&&) const noexcept;
+
+    // Implementation details: element lookup, deduced from a single base
+    private:
+    template <std::size_t Index, class Type, class Key>
+    static constexpr auto& _at(
+        object_pack_element<Type, pack_index<Index>, Key>&
+    ) noexcept;
+    template <std::size_t Index, class Type, class Key>
+    static constexpr const auto& _at(
+        const object_pack_element<Type, pack_index<Index>, Key>&
+    ) noexcept;
+
+    // Implementation details: key lookup in unevaluated contexts, an exact key
+    // deducing a single base, and any other key being resolved as an overload
+    private:
+    template <class Key, class Type, class Index>
+    static Index _find(const volatile object_pack_element<
+        Type, Index, std::remove_reference_t<Key>
+    >*);
+    template <class Key>
+    static pack_key_table<
+        Key, pack_index_sequence<Indices...>, Types...
+    > _find(const volatile void*);
+
+    // Implementation details: types and constants
+    private:
+    using element_type = void;
+    using type = void;
+    using index_type = void;
+    using key_type = void;
+    static constexpr std::size_t index = -1;
+};
+/* ************************************************************************** */
+
+
+
+/* *************************** PADDED OBJECT PACK *************************** */
+// Padded object pack class definition: an object pack whose elements can be
+// written by different threads without false sharing
+template <class... Types>
+class padded_object_pack
+: padded_object_pack_base<make_pack_index_sequence<sizeof...(Types)>, Types...>
+{
+    // Implementation details: type traits
+    private:
+    template <class... Args>
+    using _if_constructible_from_t = if_object_pack_constructible_t<
+        padded_object_pack,
+        Args...
+    >;
+    static constexpr bool _is_nothrow_default_constructible_v
+    = pack_conjunction_v<std::is_nothrow_default_constructible_v<Types>...>;
+    static constexpr bool _is_nothrow_copy_constructible_v
+    = pack_conjunction_v<std::is_nothrow_copy_constructible_v<Types>...>;
+    template <class... Args>
+    static constexpr bool _is_nothrow_constructible_from_v
+    = pack_conjunction_v<std::is_nothrow_constructible_v<Types, Args>...>;
+
+    // Types and inheritance
+    public:
+    using size_type = std::size_t;
+    using index_sequence = make_pack_index_sequence<sizeof...(Types)>;
+    using base = padded_object_pack_base<index_sequence, Types...>;
+    using base::operator[];
+
+    // Lifecycle
+    public:
+    constexpr padded_object_pack() = default;
+    explicit constexpr padded_object_pack(
+        uninitialized_t
+    ) noexcept(_is_nothrow_default_constructible_v);
+    explicit constexpr padded_object_pack(
+        const Types&...
+    ) noexcept(_is_nothrow_copy_constructible_v);
+    template <class... Args, class = _if_constructible_from_t<Args&&...>>
+    explicit constexpr padded_object_pack(
+        Args&&...
+    ) noexcept(_is_nothrow_constructible_from_v<Args&&...>);
+
+    // Size
+    public:
+    static constexpr size_type size() noexcept;
+};
+/* ************************************************************************** */
+
+
+
+/* ************************ PADDED OBJECT PACK: GET ************************* */
+// Padded object pack get overload set declaration
+template <std::size_t Index, class... Types>
+constexpr std::tuple_element_t<Index, padded_object_pack<Types...>>& get(
+    padded_object_pack<Types...>&
+) noexcept;
+template <std::size_t Index, class... Types>
+constexpr const std::tuple_element_t<Index, padded_object_pack<Types...>>& get(
+    const padded_object_pack<Types...>&
+) noexcept;
+template <std::size_t Index, class... Types>
+constexpr std::tuple_element_t<Index, padded_object_pack<Types...>>&& get(
+    padded_object_pack<Types...>&&
+) noexcept;
+template <std::size_t Index, class... Types>
+constexpr const std::tuple_element_t<Index, padded_object_pack<Types...>>&&
+get(
+    const padded_object_pack<Types...>&&
+) noexcept;
+/* ************************************************************************** */
+
+
+
+// ------------------- PADDED OBJECT PACK BASE: LIFECYCLE ------------------- //
+// Explicitly constructs a padded object pack base through default
+// initialization
+template <std::size_t... Indices, class... Types>
+constexpr padded_object_pack_base<pack_index_sequence<Indices...>, Types...>::
+padded_object_pack_base(
+    uninitialized_t tag
+) noexcept(_is_nothrow_default_constructible_v)
+: padded_object_pack_element<Types, pack_index<Indices>>(tag)...
+{
+}
+
+// Explicitly constructs a padded object pack base from objects
+template <std::size_t... Indices, class... Types>
+constexpr padded_object_pack_base<pack_index_sequence<Indices...>, Types...>::
+padded_object_pack_base(
+    const Types&... objects
+) noexcept(_is_nothrow_copy_constructible_v)
+: padded_object_pack_element<Types, pack_index<Indices>>(objects)...
+{
+}
+
+// Explicitly constructs a padded object pack base by forwarding arguments
+template <std::size_t... Indices, class... Types>
+template <class... Args, class>
+constexpr padded_object_pack_base<pack_index_sequence<Indices...>, Types...>::
+padded_object_pack_base(
+    Args&&... args
+) noexcept(_is_nothrow_constructible_from_v<Args&&...>)
+: padded_object_pack_element<Types, pack_index<Indices>>(
+    std::forward<Args>(args)
+)...
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- PADDED OBJECT PACK BASE: ACCESS --------------------- //
+// Returns the object pack element corresponding to the index
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index>
+constexpr auto&
+padded_object_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    pack_index<Index>
+) noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Immutably returns the object pack element corresponding to the index
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index>
+constexpr const auto&
+padded_object_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    pack_index<Index>
+) const noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Returns the object pack element corresponding to the key
+template <std::size_t... Indices, class... Types>
+template <class Key>
+constexpr auto&
+padded_object_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    Key&&
+) noexcept
+{
+    return _at<decltype(_find<Key>(this))::value>(*this);
+}
+
+// Immutably returns the object pack element corresponding to the key
+template <std::size_t... Indices, class... Types>
+template <class Key>
+constexpr const auto&
+padded_object_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    Key&&
+) const noexcept
+{
+    return _at<decltype(_find<Key>(this))::value>(*this);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------ PADDED OBJECT PACK BASE: IMPLEMENTATION DETAILS ------------- //
+// Returns the element at the index, deduced through its padded element
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index, class Type, class Key>
+constexpr auto&
+padded_object_pack_base<pack_index_sequence<Indices...>, Types...>::_at(
+    object_pack_element<Type, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
+
+// Immutably returns the element at the index
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index, class Type, class Key>
+constexpr const auto&
+padded_object_pack_base<pack_index_sequence<Indices...>, Types...>::_at(
+    const object_pack_element<Type, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- PADDED OBJECT PACK: LIFECYCLE ---------------------- //
+// Explicitly constructs a padded object pack through default initialization
+template <class... Types>
+constexpr padded_object_pack<Types...>::padded_object_pack(
+    uninitialized_t tag
+) noexcept(_is_nothrow_default_constructible_v)
+: base(tag)
+{
+}
+
+// Explicitly constructs a padded object pack from objects
+template <class... Types>
+constexpr padded_object_pack<Types...>::padded_object_pack(
+    const Types&... objects
+) noexcept(_is_nothrow_copy_constructible_v)
+: base(objects...)
+{
+}
+
+// Explicitly constructs a padded object pack by forwarding arguments
+template <class... Types>
+template <class... Args, class>
+constexpr padded_object_pack<Types...>::padded_object_pack(
+    Args&&... args
+) noexcept(_is_nothrow_constructible_from_v<Args&&...>)
+: base(std::forward<Args>(args)...)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ PADDED OBJECT PACK: SIZE ------------------------ //
+// Returns the number of elements in the pack
+template <class... Types>
+constexpr typename padded_object_pack<Types...>::size_type
+padded_object_pack<Types...>::size(
+) noexcept
+{
+    return sizeof...(Types);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ PADDED OBJECT PACK: GET ------------------------- //
+// Returns a reference to the object at the given index
+template <std::size_t Index, class... Types>
+constexpr std::tuple_element_t<Index, padded_object_pack<Types...>>& get(
+    padded_object_pack<Types...>& pack
+) noexcept
+{
+    return pack[pack_index_v<Index>].value();
+}
+
+// Returns an immutable reference to the object at the given index
+template <std::size_t Index, class... Types>
+constexpr const std::tuple_element_t<Index, padded_object_pack<Types...>>& get(
+    const padded_object_pack<Types...>& pack
+) noexcept
+{
+    return pack[pack_index_v<Index>].value();
+}
+
+// Returns an rvalue reference to the object at the given index
+template <std::size_t Index, class... Types>
+constexpr std::tuple_element_t<Index, padded_object_pack<Types...>>&& get(
+    padded_object_pack<Types...>&& pack
+) noexcept
+{
+    return std::move(pack[pack_index_v<Index>]).value();
+}
+
+// Returns an immutable rvalue reference to the object at the given index
+template <std::size_t Index, class... Types>
+constexpr const std::tuple_element_t<Index, padded_object_pack<Types...>>&&
+get(
+    const padded_object_pack<Types...>&& pack
+) noexcept
+{
+    return std::move(pack[pack_index_v<Index>]).value();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+namespace std {
+// ========================================================================== //
+
+
+
+/* ********************* TUPLE SIZE: PADDED OBJECT PACK ********************* */
+// Tuple size specialization for padded object packs
+template <class... Types>
+struct tuple_size<pck::padded_object_pack<Types...>>
+: integral_constant<size_t, sizeof...(Types)>
+{
+};
+/* ************************************************************************** */
+
+
+
+/* ******************* TUPLE ELEMENT: PADDED OBJECT PACK ******************** */
+// Tuple element specialization for padded object packs
+template <size_t Index, class... Types>
+struct tuple_element<Index, pck::padded_object_pack<Types...>>
+{
+    using type = typename remove_reference_t<decltype(
+        declval<pck::padded_object_pack<Types...>&>()[pck::pack_index_v<Index>]
+    )>::type;
+};
+/* ************************************************************************** */
+
+
+
+// ========================================================================== //
+} // namespace std
+#endif // _PADDED_OBJECT_PACK_HPP_INCLUDED
+// ========================================================================== //
@@ -26,6 +26,10 @@ template <class, class...>
 class reference_pack_base;
 template <class... Types>
 class reference_pack;
+template <class... Types>
+class object_pack;
+template <class, class...>
+class pack_expression;
 // ========================================================================== //
 
 
@@ -38,62 +42,67 @@ struct is_reference_pack_constructible
 {
 };
 
-// Is reference pack constructible specialization: reference pack element
+// Is reference pack constructible specialization: reference pack element,
+// binding references without temporaries, from arguments of the referenced
+// type or of a type derived from it, and rvalue references from rvalues only
 template <class Type, class Index, class Key, class Arg>
 struct is_reference_pack_constructible<
     reference_pack_element<Type, Index, Key>,
     Arg
 >
 : std::bool_constant<
-    std::is_same_v<
-        std::remove_cv_t<std::remove_reference_t<Arg>>,
-        std::remove_cv_t<std::remove_reference_t<Type>>
+    std::is_constructible_v<
+        std::conditional_t<
+            std::is_rvalue_reference_v<Type>,
+            std::remove_cv_t<std::remove_reference_t<Type>>,
+            Type
+        >,
+        Arg
     > &&
-    !std::is_same_v<
-        std::remove_cv_t<std::remove_reference_t<Arg>>,
-        reference_pack_element<Type, Index, Key>
-    >
+    std::is_convertible_v<
+        std::remove_reference_t<Arg>*,
+        std::remove_reference_t<Type>*
+    > &&
+    !(std::is_rvalue_reference_v<Type> && std::is_lvalue_reference_v<Arg>)
+>
+{
+};
+
+// Is reference pack constructible specialization: elements from as many args
+template <class... Elements, class... Args>
+struct is_reference_pack_constructible<
+    std::tuple<Elements...>,
+    std::tuple<Args...>
 >
+: std::bool_constant<pack_conjunction_v<
+    is_reference_pack_constructible<Elements, Args>::value...
+>>
 {
 };
 
 // Is reference pack constructible specialization: reference pack base
-template <class Index, class Type, class... Types, class Arg, class... Args>
+template <std::size_t... Indices, class... Types, class... Args>
 struct is_reference_pack_constructible<
-    reference_pack_base<Index, Type, Types...>,
-    Arg,
+    reference_pack_base<pack_index_sequence<Indices...>, Types...>,
     Args...
 >
-: std::bool_constant<
-    std::is_same_v<
-        std::tuple<Arg, std::remove_cv_t<std::remove_reference_t<Args>>...>,
-        std::tuple<Type, std::remove_cv_t<std::remove_reference_t<Types>>...>
-    > &&
-    !std::is_same_v<
-        std::remove_cv_t<std::remove_reference_t<Arg>>,
-        reference_pack_base<Index, Type, Types...>
+: std::conjunction<
+    std::bool_constant<sizeof...(Types) == sizeof...(Args)>,
+    is_reference_pack_constructible<
+        std::tuple<reference_pack_element<Types, pack_index<Indices>>...>,
+        std::tuple<Args...>
     >
 >
 {
 };
 
 // Is reference pack constructible specialization: reference pack
-template <class Type, class... Types, class Arg, class... Args>
-struct is_reference_pack_constructible<
-    reference_pack<Type, Types...>,
-    Arg,
+template <class... Types, class... Args>
+struct is_reference_pack_constructible<reference_pack<Types...>, Args...>
+: is_reference_pack_constructible<
+    reference_pack_base<make_pack_index_sequence<sizeof...(Types)>, Types...>,
     Args...
 >
-: std::bool_constant<
-    std::is_same_v<
-        std::tuple<Arg, std::remove_cv_t<std::remove_reference_t<Args>>...>,
-        std::tuple<Type, std::remove_cv_t<std::remove_reference_t<Types>>...>
-    > &&
-    !std::is_same_v<
-        std::remove_cv_t<std::remove_reference_t<Arg>>,
-        reference_pack<Type, Types...>
-    >
->
 {
 };
 
@@ -104,7 +113,7 @@ inline constexpr bool is_reference_pack_constructible_v
 
 // Alias template
 template <class Pack, class... Args>
-using if_reference_pack_constructible_t = std::enable_if<
+using if_reference_pack_constructible_t = std::enable_if_t<
     is_reference_pack_constructible_v<Pack, Args...>
 >;
 /* ************************************************************************** */
@@ -128,6 +137,8 @@ class reference_pack_element
         std::remove_cv_t<std::remove_reference_t<Type>>,
         Type
     >;
+    static constexpr bool _is_nothrow_swappable_v
+    = std::is_nothrow_swappable_v<std::remove_reference_t<Type>>;
     
     // Types and constants
     public:
@@ -135,7 +146,7 @@ class reference_pack_element
     using type = Type;
     using index_type = Index;
     using key_type = Key;
-    static constexpr auto index = index_type::value;
+    static constexpr std::size_t index = index_type::value;
 
     // Lifecycle
     public:
@@ -153,6 +164,19 @@ class reference_pack_element
     constexpr element_type& operator[](const key_type&) noexcept;
     constexpr const element_type& operator[](const key_type&) const noexcept;
 
+    // Value
+    public:
+    constexpr _reference_type& value() & noexcept;
+    constexpr const _reference_type& value() const& noexcept;
+    constexpr _reference_type&& value() && noexcept;
+    constexpr const _reference_type&& value() const&& noexcept;
+
+    // Swap
+    public:
+    constexpr void swap(
+        reference_pack_element&
+    ) noexcept(_is_nothrow_swappable_v);
+
     // Implementation details: data members
     private:
     _reference_type _reference;
@@ -197,16 +221,53 @@ class reference_pack_base<pack_index_sequence<Indices...>, Types...>
         reference_pack_base,
         Args...
     >;
+    static constexpr bool _is_nothrow_swappable_v = pack_conjunction_v<
+        std::is_nothrow_swappable_v<std::remove_reference_t<Types>>...
+    >;
     
-    // Inheritance
-    public:
-    using reference_pack_element<Types, pack_index<Indices>>::operator[]...;
-
     // Lifecycle
     public:
     template <class... Args, class = _if_constructible_from_t<Args&&...>>
     explicit constexpr reference_pack_base(Args&&...);
 
+    // Access
+    public:
+    template <std::size_t Index>
+    constexpr auto& operator[](pack_index<Index>) noexcept;
+    template <std::size_t Index>
+    constexpr const auto& operator[](pack_index<Index>) const noexcept;
+    template <class Key>
+    constexpr auto& operator[](Key&&) noexcept;
+    template <class Key>
+    constexpr const auto& operator[](Key&&) const noexcept;
+
+    // Swap
+    public:
+    constexpr void swap(reference_pack_base&) noexcept(_is_nothrow_swappable_v);
+
+    // Implementation details: element lookup, deduced from a single base
+    private:
+    template <std::size_t Index, class Type, class Key>
+    static constexpr auto& _at(
+        reference_pack_element<Type, pack_index<Index>, Key>&
+    ) noexcept;
+    template <std::size_t Index, class Type, class Key>
+    static constexpr const auto& _at(
+        const reference_pack_element<Type, pack_index<Index>, Key>&
+    ) noexcept;
+
+    // Implementation details: key lookup in unevaluated contexts, an exact key
+    // deducing a single base, and any other key being resolved as an overload
+    private:
+    template <class Key, class Type, class Index>
+    static Index _find(const volatile reference_pack_element<
+        Type, Index, std::remove_reference_t<Key>
+    >*);
+    template <class Key>
+    static pack_key_table<
+        Key, pack_index_sequence<Indices...>, std::decay_t<Types>...
+    > _find(const volatile void*);
+
     // Implementation details: types and constants
     private:
     using element_type = void;
@@ -243,6 +304,9 @@ class reference_pack
         reference_pack,
         Args...
     >;
+    static constexpr bool _is_nothrow_swappable_v = pack_conjunction_v<
+        std::is_nothrow_swappable_v<std::remove_reference_t<Types>>...
+    >;
     
     // Types and inheritance
     public:
@@ -256,9 +320,25 @@ class reference_pack
     template <class... Args, class = _if_constructible_from_t<Args&&...>>
     explicit constexpr reference_pack(Args&&...);
 
+    // Assignment
+    public:
+    template <class Operation, class... Operands>
+    constexpr reference_pack& operator=(
+        const pack_expression<Operation, Operands...>&
+    );
+
+    // Swap
+    public:
+    constexpr void swap(reference_pack&) noexcept(_is_nothrow_swappable_v);
+
     // Size
     public:
     static constexpr size_type size() noexcept;
+
+    // Implementation details: assignment
+    private:
+    template <class Expression, std::size_t... Indices>
+    constexpr void _assign(const Expression&, pack_index_sequence<Indices...>);
 };
 
 // Class template argument deduction guides
@@ -275,6 +355,40 @@ reference_pack(Types&&...)
 
 
 
+/* ************************** REFERENCE PACK: SWAP ************************** */
+// Reference pack swap overload set declaration
+template <class... Types>
+constexpr void swap(
+    reference_pack<Types...>&,
+    reference_pack<Types...>&
+) noexcept(noexcept(std::declval<reference_pack<Types...>&>().swap(
+    std::declval<reference_pack<Types...>&>()
+)));
+template <class... Types>
+constexpr void swap(
+    reference_pack<Types...>&&,
+    reference_pack<Types...>&&
+) noexcept(noexcept(std::declval<reference_pack<Types...>&>().swap(
+    std::declval<reference_pack<Types...>&>()
+)));
+/* ************************************************************************** */
+
+
+
+/* ************************** REFERENCE PACK: GET *************************** */
+// Reference pack get overload set declaration
+template <std::size_t Index, class... Types>
+constexpr decltype(auto) get(reference_pack<Types...>&) noexcept;
+template <std::size_t Index, class... Types>
+constexpr decltype(auto) get(const reference_pack<Types...>&) noexcept;
+template <std::size_t Index, class... Types>
+constexpr decltype(auto) get(reference_pack<Types...>&&) noexcept;
+template <std::size_t Index, class... Types>
+constexpr decltype(auto) get(const reference_pack<Types...>&&) noexcept;
+/* ************************************************************************** */
+
+
+
 // -------------------- REFERENCE PACK ELEMENT: LIFECYCLE ------------------- //
 // Explicitly constructs a reference pack element from a reference
 template <class Type, class Index, class Key>
@@ -356,6 +470,62 @@ reference_pack_element<Type, Index, Key>::operator[](
 
 
 
+// --------------------- REFERENCE PACK ELEMENT: VALUE ---------------------- //
+// Returns the reference, or a reference to the object bound from an rvalue
+template <class Type, class Index, class Key>
+constexpr typename reference_pack_element<Type, Index, Key>::_reference_type&
+reference_pack_element<Type, Index, Key>::value(
+) & noexcept
+{
+    return _reference;
+}
+
+// Immutably returns the reference, or a reference to the object
+template <class Type, class Index, class Key>
+constexpr const
+typename reference_pack_element<Type, Index, Key>::_reference_type&
+reference_pack_element<Type, Index, Key>::value(
+) const& noexcept
+{
+    return _reference;
+}
+
+// Forwards the reference, or moves out the object bound from an rvalue
+template <class Type, class Index, class Key>
+constexpr typename reference_pack_element<Type, Index, Key>::_reference_type&&
+reference_pack_element<Type, Index, Key>::value(
+) && noexcept
+{
+    return static_cast<_reference_type&&>(_reference);
+}
+
+// Immutably forwards the reference, or moves out the object
+template <class Type, class Index, class Key>
+constexpr const
+typename reference_pack_element<Type, Index, Key>::_reference_type&&
+reference_pack_element<Type, Index, Key>::value(
+) const&& noexcept
+{
+    return static_cast<const _reference_type&&>(_reference);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- REFERENCE PACK ELEMENT: SWAP ---------------------- //
+// Swaps the referred objects, or the objects bound from rvalues
+template <class Type, class Index, class Key>
+constexpr void reference_pack_element<Type, Index, Key>::swap(
+    reference_pack_element& other
+) noexcept(_is_nothrow_swappable_v)
+{
+    using std::swap;
+    swap(_reference, other._reference);
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ---------------------- REFERENCE PACK BASE: LIFECYCLE -------------------- //
 // Explicitly constructs a reference pack base from references
 template <std::size_t... Indices, class... Types>
@@ -373,6 +543,94 @@ reference_pack_base(
 
 
 
+// ---------------------- REFERENCE PACK BASE: ACCESS ----------------------- //
+// Returns the reference pack element corresponding to the index
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index>
+constexpr auto&
+reference_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    pack_index<Index>
+) noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Immutably returns the reference pack element corresponding to the index
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index>
+constexpr const auto&
+reference_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    pack_index<Index>
+) const noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Returns the reference pack element corresponding to the key
+template <std::size_t... Indices, class... Types>
+template <class Key>
+constexpr auto&
+reference_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    Key&&
+) noexcept
+{
+    return _at<decltype(_find<Key>(this))::value>(*this);
+}
+
+// Immutably returns the reference pack element corresponding to the key
+template <std::size_t... Indices, class... Types>
+template <class Key>
+constexpr const auto&
+reference_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    Key&&
+) const noexcept
+{
+    return _at<decltype(_find<Key>(this))::value>(*this);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- REFERENCE PACK BASE: SWAP ------------------------ //
+// Swaps the referred objects element by element
+template <std::size_t... Indices, class... Types>
+constexpr void reference_pack_base<pack_index_sequence<Indices...>, Types...>::
+swap(
+    reference_pack_base& other
+) noexcept(_is_nothrow_swappable_v)
+{
+    (reference_pack_element<Types, pack_index<Indices>>::swap(other), ...);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------- REFERENCE PACK BASE: IMPLEMENTATION DETAILS --------------- //
+// Returns the element at the index, the only base that can be deduced
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index, class Type, class Key>
+constexpr auto&
+reference_pack_base<pack_index_sequence<Indices...>, Types...>::_at(
+    reference_pack_element<Type, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
+
+// Immutably returns the element at the index
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index, class Type, class Key>
+constexpr const auto&
+reference_pack_base<pack_index_sequence<Indices...>, Types...>::_at(
+    const reference_pack_element<Type, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ------------------------ REFERENCE PACK: LIFECYCLE ----------------------- //
 // Explicitly constructs a reference pack from references
 template <class... Types>
@@ -387,6 +645,74 @@ constexpr reference_pack<Types...>::reference_pack(
 
 
 
+// ----------------------- REFERENCE PACK: ASSIGNMENT ----------------------- //
+// Evaluates an elementwise expression once into the referred objects
+template <class... Types>
+template <class Operation, class... Operands>
+constexpr reference_pack<Types...>& reference_pack<Types...>::operator=(
+    const pack_expression<Operation, Operands...>& expression
+)
+{
+    using expression_type = pack_expression<Operation, Operands...>;
+    static_assert(expression_type::size() == size(), "mismatching sizes");
+    _assign(expression, index_sequence{});
+    return *this;
+}
+
+// Computes all the elements before storing them, so that aliasing is safe
+template <class... Types>
+template <class Expression, std::size_t... Indices>
+constexpr void reference_pack<Types...>::_assign(
+    const Expression& expression,
+    pack_index_sequence<Indices...>
+)
+{
+    object_pack<std::decay_t<decltype(get<Indices>(expression))>...> values(
+        get<Indices>(expression)...
+    );
+    ((get<Indices>(*this) = std::move(get<Indices>(values))), ...);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- REFERENCE PACK: SWAP -------------------------- //
+// Swaps the referred objects element by element
+template <class... Types>
+constexpr void reference_pack<Types...>::swap(
+    reference_pack& other
+) noexcept(_is_nothrow_swappable_v)
+{
+    base::swap(other);
+}
+
+// Swaps the referred objects of two reference packs
+template <class... Types>
+constexpr void swap(
+    reference_pack<Types...>& lhs,
+    reference_pack<Types...>& rhs
+) noexcept(noexcept(std::declval<reference_pack<Types...>&>().swap(
+    std::declval<reference_pack<Types...>&>()
+)))
+{
+    lhs.swap(rhs);
+}
+
+// Swaps the referred objects of two temporary reference packs such as proxies
+template <class... Types>
+constexpr void swap(
+    reference_pack<Types...>&& lhs,
+    reference_pack<Types...>&& rhs
+) noexcept(noexcept(std::declval<reference_pack<Types...>&>().swap(
+    std::declval<reference_pack<Types...>&>()
+)))
+{
+    lhs.swap(rhs);
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // -------------------------- REFERENCE PACK: SIZE -------------------------- //
 // Returns the number of elements in the pack
 template <class... Types>
@@ -400,8 +726,79 @@ reference_pack<Types...>::size(
 
 
 
+// -------------------------- REFERENCE PACK: GET --------------------------- //
+// Returns the reference at the given index
+template <std::size_t Index, class... Types>
+constexpr decltype(auto) get(
+    reference_pack<Types...>& pack
+) noexcept
+{
+    return pack[pack_index_v<Index>].value();
+}
+
+// Immutably returns the reference at the given index
+template <std::size_t Index, class... Types>
+constexpr decltype(auto) get(
+    const reference_pack<Types...>& pack
+) noexcept
+{
+    return pack[pack_index_v<Index>].value();
+}
+
+// Forwards the reference at the given index
+template <std::size_t Index, class... Types>
+constexpr decltype(auto) get(
+    reference_pack<Types...>&& pack
+) noexcept
+{
+    return std::move(pack[pack_index_v<Index>]).value();
+}
+
+// Immutably forwards the reference at the given index
+template <std::size_t Index, class... Types>
+constexpr decltype(auto) get(
+    const reference_pack<Types...>&& pack
+) noexcept
+{
+    return std::move(pack[pack_index_v<Index>]).value();
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ========================================================================== //
 } // namespace pck
+namespace std {
+// ========================================================================== //
+
+
+
+/* *********************** TUPLE SIZE: REFERENCE PACK *********************** */
+// Tuple size specialization for reference packs
+template <class... Types>
+struct tuple_size<pck::reference_pack<Types...>>
+: integral_constant<size_t, sizeof...(Types)>
+{
+};
+/* ************************************************************************** */
+
+
+
+/* ********************* TUPLE ELEMENT: REFERENCE PACK ********************** */
+// Tuple element specialization for reference packs
+template <size_t Index, class... Types>
+struct tuple_element<Index, pck::reference_pack<Types...>>
+{
+    using type = typename remove_reference_t<decltype(
+        declval<pck::reference_pack<Types...>&>()[pck::pack_index_v<Index>]
+    )>::type;
+};
+/* ************************************************************************** */
+
+
+
+// ========================================================================== //
+} // namespace std
 #endif // _REFERENCE_PACK_HPP_INCLUDED
 // ========================================================================== //
 
@@ -0,0 +1,260 @@
+// ============================== SEQLOCK PACK ============================== //
+// Project:         Pack
+// Name:            seqlock_pack.hpp
+// Description:     Pack written by one thread and read by many through retries
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _SEQLOCK_PACK_HPP_INCLUDED
+#define _SEQLOCK_PACK_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <atomic>
+#include <thread>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+// Project sources
+#include "pack_details.hpp"
+#include "object_pack.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ****************************** SEQLOCK PACK ****************************** */
+// Seqlock pack class definition: the sequence is odd while the single writer
+// is copying, and readers retry until they see the same even sequence around
+// their copy, without ever writing to the shared cache lines
+template <class... Types>
+class seqlock_pack
+{
+    // Types
+    public:
+    using value_type = object_pack<Types...>;
+    using size_type = std::size_t;
+
+    // Lifecycle
+    public:
+    seqlock_pack() noexcept;
+    explicit seqlock_pack(const value_type&) noexcept;
+    seqlock_pack(const seqlock_pack&) = delete;
+    seqlock_pack& operator=(const seqlock_pack&) = delete;
+
+    // Readers
+    public:
+    value_type load() const noexcept;
+    bool try_load(value_type&) const noexcept;
+
+    // Writer
+    public:
+    void store(const value_type&) noexcept;
+    template <class Function>
+    void update(Function&&);
+
+    // Size
+    public:
+    static constexpr size_type size() noexcept;
+
+    // Implementation details: words, copied with relaxed atomics
+    private:
+    static_assert(
+        pack_conjunction_v<std::is_trivially_copyable_v<Types>...>,
+        "the types should be trivially copyable"
+    );
+    using _word_type = std::size_t;
+    static constexpr size_type _count = (
+        sizeof(value_type) + sizeof(_word_type) - 1
+    ) / sizeof(_word_type);
+    using _words_type = std::array<_word_type, _count>;
+    static value_type _decode(const _words_type&) noexcept;
+    static _words_type _encode(const value_type&) noexcept;
+    void _write(const _words_type&) noexcept;
+
+    // Implementation details: waiting
+    private:
+    static void _wait(size_type&) noexcept;
+    static constexpr size_type _spins = 64;
+
+    // Implementation details: data members, apart from other cache lines
+    private:
+    alignas(cache_line_size) std::atomic<size_type> _sequence;
+    std::array<std::atomic<_word_type>, _count> _words;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------ SEQLOCK PACK: LIFECYCLE ------------------------- //
+// Constructs a seqlock pack of value-initialized elements
+template <class... Types>
+seqlock_pack<Types...>::seqlock_pack(
+) noexcept
+: seqlock_pack(value_type())
+{
+}
+
+// Explicitly constructs a seqlock pack from a pack of values
+template <class... Types>
+seqlock_pack<Types...>::seqlock_pack(
+    const value_type& value
+) noexcept
+: _sequence(0)
+{
+    const _words_type words = _encode(value);
+    for (size_type i = 0; i < _count; ++i) {
+        _words[i].store(words[i], std::memory_order_relaxed);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- SEQLOCK PACK: READERS -------------------------- //
+// Returns a consistent copy of the elements, retrying while they are written
+template <class... Types>
+typename seqlock_pack<Types...>::value_type seqlock_pack<Types...>::load(
+) const noexcept
+{
+    value_type value(uninitialized);
+    size_type attempts = 0;
+    while (!try_load(value)) {
+        _wait(attempts);
+    }
+    return value;
+}
+
+// Copies the elements, or returns false if the writer interfered
+template <class... Types>
+bool seqlock_pack<Types...>::try_load(
+    value_type& value
+) const noexcept
+{
+    const size_type sequence = _sequence.load(std::memory_order_acquire);
+    if (sequence % 2 != 0) {
+        return false;
+    }
+    _words_type words;
+    for (size_type i = 0; i < _count; ++i) {
+        words[i] = _words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (_sequence.load(std::memory_order_relaxed) != sequence) {
+        return false;
+    }
+    value = _decode(words);
+    return true;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- SEQLOCK PACK: WRITER -------------------------- //
+// Replaces the elements: only one thread may write
+template <class... Types>
+void seqlock_pack<Types...>::store(
+    const value_type& value
+) noexcept
+{
+    _write(_encode(value));
+}
+
+// Applies a function to a copy of the elements and stores it: only one
+// thread may write, so the copy can be read without retrying
+template <class... Types>
+template <class Function>
+void seqlock_pack<Types...>::update(
+    Function&& function
+)
+{
+    _words_type words;
+    for (size_type i = 0; i < _count; ++i) {
+        words[i] = _words[i].load(std::memory_order_relaxed);
+    }
+    value_type value = _decode(words);
+    std::invoke(std::forward<Function>(function), value);
+    _write(_encode(value));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- SEQLOCK PACK: SIZE --------------------------- //
+// Returns the number of elements in the pack
+template <class... Types>
+constexpr typename seqlock_pack<Types...>::size_type
+seqlock_pack<Types...>::size(
+) noexcept
+{
+    return sizeof...(Types);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------ SEQLOCK PACK: IMPLEMENTATION DETAILS ------------------ //
+// Copies words into a pack
+template <class... Types>
+typename seqlock_pack<Types...>::value_type seqlock_pack<Types...>::_decode(
+    const _words_type& words
+) noexcept
+{
+    value_type value(uninitialized);
+    std::memcpy(static_cast<void*>(&value), words.data(), sizeof(value_type));
+    return value;
+}
+
+// Copies a pack into words whose trailing bytes are zeroed
+template <class... Types>
+typename seqlock_pack<Types...>::_words_type seqlock_pack<Types...>::_encode(
+    const value_type& value
+) noexcept
+{
+    _words_type words = {};
+    std::memcpy(words.data(), &value, sizeof(value_type));
+    return words;
+}
+
+// Makes the sequence odd, stores the words, and makes the sequence even
+// again: the fence keeps the stores of the words after the odd sequence
+template <class... Types>
+void seqlock_pack<Types...>::_write(
+    const _words_type& words
+) noexcept
+{
+    const size_type sequence = _sequence.load(std::memory_order_relaxed);
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_type i = 0; i < _count; ++i) {
+        _words[i].store(words[i], std::memory_order_relaxed);
+    }
+    _sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// Waits for the writer, spinning first then yielding the core
+template <class... Types>
+void seqlock_pack<Types...>::_wait(
+    size_type& attempts
+) noexcept
+{
+    if (++attempts > _spins) {
+        std::this_thread::yield();
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _SEQLOCK_PACK_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,344 @@
+// ============================== SHARDED PACK ============================== //
+// Project:         Pack
+// Name:            sharded_pack.hpp
+// Description:     Pack replicated for each thread and aggregated on demand
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _SHARDED_PACK_HPP_INCLUDED
+#define _SHARDED_PACK_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <functional>
+#include <type_traits>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "object_pack.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ****************************** SHARDED PACK ****************************** */
+// Sharded pack class definition: each thread updates its own replica, on its
+// own cache lines, with plain loads and stores, and the replicas are folded
+// together on demand; the replica of an exiting thread is kept with its
+// values and handed to the next thread that registers
+template <class... Types>
+class sharded_pack
+{
+    // Types
+    public:
+    using value_type = object_pack<Types...>;
+    using size_type = std::size_t;
+
+    // Lifecycle
+    public:
+    sharded_pack();
+    sharded_pack(const sharded_pack&) = delete;
+    sharded_pack& operator=(const sharded_pack&) = delete;
+
+    // Writer
+    public:
+    template <class Function>
+    void update(Function&&);
+
+    // Aggregation
+    public:
+    template <class Operation = std::plus<>>
+    value_type aggregate(Operation&& = Operation()) const;
+
+    // Size
+    public:
+    static constexpr size_type size() noexcept;
+
+    // Implementation details: words, accessed with relaxed atomics
+    private:
+    static_assert(
+        pack_conjunction_v<std::is_trivially_copyable_v<Types>...>,
+        "the types should be trivially copyable"
+    );
+    using _word_type = std::size_t;
+    static constexpr size_type _count = (
+        sizeof(value_type) + sizeof(_word_type) - 1
+    ) / sizeof(_word_type);
+    using _words_type = std::array<_word_type, _count>;
+    static value_type _decode(const _words_type&) noexcept;
+    static _words_type _encode(const value_type&) noexcept;
+    template <class Operation, std::size_t... Indices>
+    static void _fold(
+        value_type&,
+        const value_type&,
+        Operation&,
+        pack_index_sequence<Indices...>
+    );
+
+    // Implementation details: replicas, shared by all the threads
+    private:
+    struct alignas(cache_line_size) _replica {
+        std::array<std::atomic<_word_type>, _count> words;
+        bool owned = false;
+    };
+    struct _core {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<_replica>> replicas;
+    };
+    static _words_type _load(const _replica&) noexcept;
+    static _replica* _acquire(_core&);
+    static void _release(_core&, _replica*) noexcept;
+
+    // Implementation details: thread-local slots, released on thread exit
+    private:
+    struct _slot {
+        std::shared_ptr<_core> core;
+        _replica* replica = nullptr;
+    };
+    struct _slot_table {
+        _slot_table() = default;
+        _slot_table(const _slot_table&) = delete;
+        _slot_table& operator=(const _slot_table&) = delete;
+        ~_slot_table();
+        std::array<_slot, 4> slots;
+        std::size_t next = 0;
+    };
+    _replica& _local();
+    static void _reset(_slot&) noexcept;
+
+    // Implementation details: data members
+    private:
+    inline static thread_local _slot_table _table;
+    std::shared_ptr<_core> _core_pointer;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------ SHARDED PACK: LIFECYCLE ------------------------- //
+// Constructs a sharded pack without replicas: the threads still holding one
+// keep the replicas alive after the destruction of the pack
+template <class... Types>
+sharded_pack<Types...>::sharded_pack(
+)
+: _core_pointer(std::make_shared<_core>())
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- SHARDED PACK: WRITER --------------------------- //
+// Applies a function to the replica of the thread: no other thread writes to
+// it, so relaxed loads and stores are enough and compile to plain moves
+template <class... Types>
+template <class Function>
+void sharded_pack<Types...>::update(
+    Function&& function
+)
+{
+    _replica& replica = _local();
+    value_type value = _decode(_load(replica));
+    std::invoke(std::forward<Function>(function), value);
+    const _words_type words = _encode(value);
+    for (size_type i = 0; i < _count; ++i) {
+        replica.words[i].store(words[i], std::memory_order_relaxed);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- SHARDED PACK: AGGREGATION ------------------------ //
+// Folds the replicas, element by element, starting from the first one, so
+// that no identity of the operation is needed: without replicas, returns a
+// value-initialized pack; the updates in progress in other threads may or
+// may not be counted
+template <class... Types>
+template <class Operation>
+typename sharded_pack<Types...>::value_type sharded_pack<Types...>::aggregate(
+    Operation&& operation
+) const
+{
+    value_type result{};
+    const std::lock_guard<std::mutex> lock(_core_pointer->mutex);
+    const auto& replicas = _core_pointer->replicas;
+    if (!replicas.empty()) {
+        result = _decode(_load(*replicas.front()));
+    }
+    for (size_type i = 1; i < replicas.size(); ++i) {
+        _fold(
+            result,
+            _decode(_load(*replicas[i])),
+            operation,
+            make_pack_index_sequence_v<sizeof...(Types)>
+        );
+    }
+    return result;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- SHARDED PACK: SIZE --------------------------- //
+// Returns the number of elements in the pack
+template <class... Types>
+constexpr typename sharded_pack<Types...>::size_type
+sharded_pack<Types...>::size(
+) noexcept
+{
+    return sizeof...(Types);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------ SHARDED PACK: IMPLEMENTATION DETAILS ------------------ //
+// Copies words into a pack
+template <class... Types>
+typename sharded_pack<Types...>::value_type sharded_pack<Types...>::_decode(
+    const _words_type& words
+) noexcept
+{
+    value_type value(uninitialized);
+    std::memcpy(static_cast<void*>(&value), words.data(), sizeof(value_type));
+    return value;
+}
+
+// Copies a pack into words whose trailing bytes are zeroed
+template <class... Types>
+typename sharded_pack<Types...>::_words_type sharded_pack<Types...>::_encode(
+    const value_type& value
+) noexcept
+{
+    _words_type words = {};
+    std::memcpy(words.data(), &value, sizeof(value_type));
+    return words;
+}
+
+// Combines each element of the result with the same element of a replica
+template <class... Types>
+template <class Operation, std::size_t... Indices>
+void sharded_pack<Types...>::_fold(
+    value_type& result,
+    const value_type& value,
+    Operation& operation,
+    pack_index_sequence<Indices...>
+)
+{
+    ((result[pack_index_v<Indices>].value() = std::invoke(
+        operation,
+        std::as_const(result)[pack_index_v<Indices>].value(),
+        value[pack_index_v<Indices>].value()
+    )), ...);
+}
+
+// Loads the words of a replica
+template <class... Types>
+typename sharded_pack<Types...>::_words_type sharded_pack<Types...>::_load(
+    const _replica& replica
+) noexcept
+{
+    _words_type words;
+    for (size_type i = 0; i < _count; ++i) {
+        words[i] = replica.words[i].load(std::memory_order_relaxed);
+    }
+    return words;
+}
+
+// Hands a released replica to the calling thread, or creates a zeroed one
+template <class... Types>
+typename sharded_pack<Types...>::_replica* sharded_pack<Types...>::_acquire(
+    _core& core
+)
+{
+    const std::lock_guard<std::mutex> lock(core.mutex);
+    for (const std::unique_ptr<_replica>& replica : core.replicas) {
+        if (!replica->owned) {
+            replica->owned = true;
+            return replica.get();
+        }
+    }
+    const _words_type words = _encode(value_type{});
+    std::unique_ptr<_replica> replica = std::make_unique<_replica>();
+    for (size_type i = 0; i < _count; ++i) {
+        replica->words[i].store(words[i], std::memory_order_relaxed);
+    }
+    replica->owned = true;
+    core.replicas.push_back(std::move(replica));
+    return core.replicas.back().get();
+}
+
+// Gives a replica back, keeping its values for the aggregation
+template <class... Types>
+void sharded_pack<Types...>::_release(
+    _core& core,
+    _replica* replica
+) noexcept
+{
+    const std::lock_guard<std::mutex> lock(core.mutex);
+    replica->owned = false;
+}
+
+// Returns the replica of the thread for this pack, evicting another if needed
+template <class... Types>
+typename sharded_pack<Types...>::_replica& sharded_pack<Types...>::_local(
+)
+{
+    _slot_table& table = _table;
+    for (_slot& slot : table.slots) {
+        if (slot.core == _core_pointer) {
+            return *slot.replica;
+        }
+    }
+    _slot& slot = table.slots[table.next++ % table.slots.size()];
+    _reset(slot);
+    slot.replica = _acquire(*_core_pointer);
+    slot.core = _core_pointer;
+    return *slot.replica;
+}
+
+// Releases the replica of a slot, and forgets the pack
+template <class... Types>
+void sharded_pack<Types...>::_reset(
+    _slot& slot
+) noexcept
+{
+    if (slot.core) {
+        _release(*slot.core, slot.replica);
+        slot.core.reset();
+        slot.replica = nullptr;
+    }
+}
+
+// Releases the replicas held by an exiting thread
+template <class... Types>
+sharded_pack<Types...>::_slot_table::~_slot_table(
+)
+{
+    for (_slot& slot : slots) {
+        _reset(slot);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _SHARDED_PACK_HPP_INCLUDED
+// ========================================================================== //
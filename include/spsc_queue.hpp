@@ -0,0 +1,319 @@
+// =============================== SPSC QUEUE =============================== //
+// Project:         Pack
+// Name:            spsc_queue.hpp
+// Description:     Bounded lock-free single-producer single-consumer queue
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _SPSC_QUEUE_HPP_INCLUDED
+#define _SPSC_QUEUE_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <new>
+#include <atomic>
+#include <utility>
+// Project sources
+#include "pack_details.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ******************************* SPSC QUEUE ******************************* */
+// Spsc queue class definition: a ring buffer shared by two threads
+template <class Type, std::size_t Capacity>
+class spsc_queue
+{
+    // Types
+    public:
+    using value_type = Type;
+    using size_type = std::size_t;
+
+    // Lifecycle
+    public:
+    spsc_queue() noexcept;
+    spsc_queue(const spsc_queue&) = delete;
+    spsc_queue& operator=(const spsc_queue&) = delete;
+    ~spsc_queue();
+
+    // Producer
+    public:
+    template <class... Args>
+    bool try_emplace(Args&&...);
+    bool try_push(const value_type&);
+    bool try_push(value_type&&);
+    template <class InputIt>
+    InputIt try_push_n(InputIt, InputIt);
+    void close() noexcept;
+
+    // Consumer
+    public:
+    bool try_pop(value_type&);
+    template <class Function>
+    size_type try_pop_n(Function&&, size_type);
+    bool is_closed() const noexcept;
+    bool empty() const noexcept;
+
+    // Capacity
+    public:
+    static constexpr size_type capacity() noexcept;
+
+    // Implementation details: slots
+    private:
+    static_assert(Capacity > 0, "capacity should be positive");
+    static_assert((Capacity & (Capacity - 1)) == 0, "capacity should be 2^n");
+    static constexpr size_type _mask = Capacity - 1;
+    using _slot_type = std::aligned_storage_t<sizeof(Type), alignof(Type)>;
+    value_type* _slot(size_type) noexcept;
+    bool _is_full(size_type) noexcept;
+    bool _is_drained(size_type) noexcept;
+
+    // Implementation details: data members, one cache line per thread
+    private:
+    alignas(cache_line_size) std::atomic<size_type> _head;
+    size_type _cached_tail;
+    alignas(cache_line_size) std::atomic<size_type> _tail;
+    size_type _cached_head;
+    std::atomic<bool> _closed;
+    alignas(cache_line_size) std::array<_slot_type, Capacity> _slots;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- SPSC QUEUE: LIFECYCLE -------------------------- //
+// Constructs an empty open queue
+template <class Type, std::size_t Capacity>
+spsc_queue<Type, Capacity>::spsc_queue(
+) noexcept
+: _head(0)
+, _cached_tail(0)
+, _tail(0)
+, _cached_head(0)
+, _closed(false)
+{
+}
+
+// Destroys the elements that have not been popped
+template <class Type, std::size_t Capacity>
+spsc_queue<Type, Capacity>::~spsc_queue(
+)
+{
+    const size_type tail = _tail.load(std::memory_order_relaxed);
+    for (size_type i = _head.load(std::memory_order_relaxed); i != tail; ++i) {
+        _slot(i)->~value_type();
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- SPSC QUEUE: PRODUCER -------------------------- //
+// Constructs an element at the back, or returns false if the queue is full
+template <class Type, std::size_t Capacity>
+template <class... Args>
+bool spsc_queue<Type, Capacity>::try_emplace(
+    Args&&... args
+)
+{
+    const size_type tail = _tail.load(std::memory_order_relaxed);
+    if (_is_full(tail)) {
+        return false;
+    }
+    ::new (static_cast<void*>(&_slots[tail & _mask])) value_type(
+        std::forward<Args>(args)...
+    );
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// Copies an element at the back, or returns false if the queue is full
+template <class Type, std::size_t Capacity>
+bool spsc_queue<Type, Capacity>::try_push(
+    const value_type& value
+)
+{
+    return try_emplace(value);
+}
+
+// Moves an element at the back, or returns false if the queue is full
+template <class Type, std::size_t Capacity>
+bool spsc_queue<Type, Capacity>::try_push(
+    value_type&& value
+)
+{
+    return try_emplace(std::move(value));
+}
+
+// Moves as many elements as fit, publishes them at once, and returns the rest:
+// if a move throws, the elements moved before it are published
+template <class Type, std::size_t Capacity>
+template <class InputIt>
+InputIt spsc_queue<Type, Capacity>::try_push_n(
+    InputIt first,
+    InputIt last
+)
+{
+    const size_type tail = _tail.load(std::memory_order_relaxed);
+    size_type i = tail;
+    for (; first != last && !_is_full(i); ++first, ++i) {
+        try {
+            ::new (static_cast<void*>(&_slots[i & _mask])) value_type(
+                std::move(*first)
+            );
+        } catch (...) {
+            if (i != tail) {
+                _tail.store(i, std::memory_order_release);
+            }
+            throw;
+        }
+    }
+    if (i != tail) {
+        _tail.store(i, std::memory_order_release);
+    }
+    return first;
+}
+
+// Marks the end of the stream: no element will be pushed anymore
+template <class Type, std::size_t Capacity>
+void spsc_queue<Type, Capacity>::close(
+) noexcept
+{
+    _closed.store(true, std::memory_order_release);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- SPSC QUEUE: CONSUMER -------------------------- //
+// Moves the front element out, or returns false if the queue is empty
+template <class Type, std::size_t Capacity>
+bool spsc_queue<Type, Capacity>::try_pop(
+    value_type& value
+)
+{
+    const size_type head = _head.load(std::memory_order_relaxed);
+    if (_is_drained(head)) {
+        return false;
+    }
+    value_type* slot = _slot(head);
+    value = std::move(*slot);
+    slot->~value_type();
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+// Hands at most count elements to a function, and releases them at once: if
+// the function throws, the element it was handed is consumed, and the others
+// are left in the queue
+template <class Type, std::size_t Capacity>
+template <class Function>
+typename spsc_queue<Type, Capacity>::size_type
+spsc_queue<Type, Capacity>::try_pop_n(
+    Function&& function,
+    size_type count
+)
+{
+    const size_type head = _head.load(std::memory_order_relaxed);
+    size_type i = head;
+    for (; i - head < count && !_is_drained(i); ++i) {
+        value_type* slot = _slot(i);
+        try {
+            function(std::move(*slot));
+        } catch (...) {
+            slot->~value_type();
+            _head.store(i + 1, std::memory_order_release);
+            throw;
+        }
+        slot->~value_type();
+    }
+    if (i != head) {
+        _head.store(i, std::memory_order_release);
+    }
+    return i - head;
+}
+
+// Checks whether the producer closed the queue: checked before a last pop
+template <class Type, std::size_t Capacity>
+bool spsc_queue<Type, Capacity>::is_closed(
+) const noexcept
+{
+    return _closed.load(std::memory_order_acquire);
+}
+
+// Checks whether the queue is empty, as seen by the consumer
+template <class Type, std::size_t Capacity>
+bool spsc_queue<Type, Capacity>::empty(
+) const noexcept
+{
+    const size_type head = _head.load(std::memory_order_relaxed);
+    return head == _tail.load(std::memory_order_acquire);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- SPSC QUEUE: CAPACITY -------------------------- //
+// Returns the maximum number of elements in the queue
+template <class Type, std::size_t Capacity>
+constexpr typename spsc_queue<Type, Capacity>::size_type
+spsc_queue<Type, Capacity>::capacity(
+) noexcept
+{
+    return Capacity;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- SPSC QUEUE: IMPLEMENTATION DETAILS ------------------- //
+// Returns a pointer to the element in the slot at the given position
+template <class Type, std::size_t Capacity>
+typename spsc_queue<Type, Capacity>::value_type*
+spsc_queue<Type, Capacity>::_slot(
+    size_type position
+) noexcept
+{
+    return std::launder(reinterpret_cast<value_type*>(
+        &_slots[position & _mask]
+    ));
+}
+
+// Checks whether the producer would overrun the consumer at the position
+template <class Type, std::size_t Capacity>
+bool spsc_queue<Type, Capacity>::_is_full(
+    size_type tail
+) noexcept
+{
+    if (tail - _cached_head == Capacity) {
+        _cached_head = _head.load(std::memory_order_acquire);
+    }
+    return tail - _cached_head == Capacity;
+}
+
+// Checks whether the consumer has caught up with the producer at the position
+template <class Type, std::size_t Capacity>
+bool spsc_queue<Type, Capacity>::_is_drained(
+    size_type head
+) noexcept
+{
+    if (head == _cached_tail) {
+        _cached_tail = _tail.load(std::memory_order_acquire);
+    }
+    return head == _cached_tail;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _SPSC_QUEUE_HPP_INCLUDED
+// ========================================================================== //
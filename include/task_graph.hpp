@@ -0,0 +1,626 @@
+// =============================== TASK GRAPH =============================== //
+// Project:         Pack
+// Name:            task_graph.hpp
+// Description:     Concurrent execution of stages ordered by their dependencies
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _TASK_GRAPH_HPP_INCLUDED
+#define _TASK_GRAPH_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <optional>
+#include <exception>
+#include <functional>
+#include <utility>
+#include <condition_variable>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "empty_pack.hpp"
+#include "type_pack.hpp"
+#include "object_pack.hpp"
+#include "pack_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* *************************** TASK DEPENDENCIES **************************** */
+// Task dependencies structure definition: no declared dependencies
+template <class Stage, class = void>
+struct task_dependencies
+{
+    using type = empty_pack;
+};
+
+// Task dependencies structure specialization: declared dependencies
+template <class Stage>
+struct task_dependencies<Stage, std::void_t<typename Stage::depends_on>>
+{
+    using type = typename Stage::depends_on;
+};
+
+// Alias template
+template <class Stage>
+using task_dependencies_t = typename task_dependencies<Stage>::type;
+/* ************************************************************************** */
+
+
+
+/* ******************************* TASK NODE ******************************** */
+// Task node class declaration
+template <class Dependencies, class... Stages>
+class task_node;
+
+// Task node class specialization: a stage without dependencies
+template <class... Stages>
+class task_node<empty_pack, Stages...>
+{
+    // Constants
+    public:
+    static constexpr std::size_t size = 0;
+    static constexpr std::array<std::size_t, size> indices = {};
+};
+
+// Task node class specialization: the indices of the dependencies
+template <class... Dependencies, class... Stages>
+class task_node<type_pack<Dependencies...>, Stages...>
+{
+    // Constants
+    public:
+    static constexpr std::size_t size = sizeof...(Dependencies);
+    static constexpr std::array<std::size_t, size> indices = {
+        type_id_table<Stages...>::find(&type_tag<Dependencies>)...
+    };
+};
+/* ************************************************************************** */
+
+
+
+/* ******************************* TASK VOID ******************************** */
+// Task void tag structure definition: the result of a stage returning void
+struct task_void_t
+{
+    explicit constexpr task_void_t() noexcept = default;
+};
+
+// Task void tag constant
+inline constexpr task_void_t task_void{};
+/* ************************************************************************** */
+
+
+
+/* ****************************** TASK RESULT ******************************* */
+// Task result structure declaration: void results are replaced by a tag
+template <class Stage, class Dependencies = task_dependencies_t<Stage>>
+struct task_result;
+
+// Task result structure specialization: a stage called without arguments
+template <class Stage>
+struct task_result<Stage, empty_pack>
+{
+    using type = std::conditional_t<
+        std::is_void_v<std::invoke_result_t<Stage&>>,
+        task_void_t,
+        std::invoke_result_t<Stage&>
+    >;
+};
+
+// Task result structure specialization: a stage called on the results
+template <class Stage, class... Dependencies>
+struct task_result<Stage, type_pack<Dependencies...>>
+{
+    using result = std::invoke_result_t<
+        Stage&,
+        const typename task_result<Dependencies>::type&...
+    >;
+    using type = std::conditional_t<
+        std::is_void_v<result>,
+        task_void_t,
+        result
+    >;
+};
+
+// Alias template
+template <class Stage>
+using task_result_t = typename task_result<Stage>::type;
+/* ************************************************************************** */
+
+
+
+/* ******************************* TASK GRAPH ******************************* */
+// Task graph class declaration
+template <class Stages>
+class task_graph;
+
+// Task graph class definition: a thread pool running stages once ready
+template <class... Stages>
+class task_graph<type_pack<Stages...>>
+{
+    // Implementation details: nodes
+    private:
+    static constexpr std::size_t _size = sizeof...(Stages);
+    template <class Stage>
+    using _node_t = task_node<task_dependencies_t<Stage>, Stages...>;
+    static constexpr std::size_t _edges = (
+        _node_t<Stages>::size + ... + std::size_t(0)
+    );
+
+    // Implementation details: plan computed at compile time
+    private:
+    struct _plan_type {
+        std::array<std::size_t, _size> order;
+        std::array<std::size_t, _size> pending;
+        std::array<std::size_t, _size + 1> offsets;
+        std::array<std::size_t, _edges> dependents;
+        std::size_t roots;
+        bool is_complete;
+        bool is_unique;
+        bool is_acyclic;
+    };
+    static constexpr _plan_type _make_plan() noexcept;
+    static constexpr _plan_type _plan = _make_plan();
+
+    // Checks
+    static_assert(_plan.is_unique, "stages should appear only once");
+    static_assert(_plan.is_complete, "dependencies should be graph stages");
+    static_assert(_plan.is_acyclic, "dependencies should not form a cycle");
+
+    // Types
+    public:
+    using size_type = std::size_t;
+    using stages_type = object_pack<Stages...>;
+    using order_type = std::array<size_type, sizeof...(Stages)>;
+    using results_type = object_pack<task_result_t<Stages>...>;
+
+    // Lifecycle
+    public:
+    task_graph();
+    explicit task_graph(size_type);
+    task_graph(size_type, const Stages&...);
+    task_graph(const task_graph&) = delete;
+    task_graph& operator=(const task_graph&) = delete;
+    ~task_graph();
+
+    // Run
+    public:
+    results_type run();
+
+    // Access
+    public:
+    stages_type& stages() noexcept;
+    const stages_type& stages() const noexcept;
+    static constexpr const order_type& order() noexcept;
+
+    // Size
+    public:
+    static constexpr size_type size() noexcept;
+    size_type threads() const noexcept;
+
+    // Implementation details: execution
+    private:
+    template <std::size_t... Indices>
+    void _execute(pack_index_sequence<Indices...>);
+    template <std::size_t Index, std::size_t... Arguments>
+    void _invoke(pack_index_sequence<Arguments...>);
+    void _push(size_type) noexcept;
+    void _serve();
+    template <std::size_t... Indices>
+    results_type _collect(pack_index_sequence<Indices...>);
+    template <std::size_t... Indices>
+    void _discard(pack_index_sequence<Indices...>) noexcept;
+    static size_type _concurrency() noexcept;
+    static void _wait(size_type&);
+
+    // Implementation details: constants
+    private:
+    static constexpr size_type _spins = 64;
+
+    // Implementation details: data members
+    private:
+    stages_type _stages;
+    object_pack<std::optional<task_result_t<Stages>>...>
+    _results;
+    std::exception_ptr _exception;
+    std::atomic<bool> _is_failed;
+    std::array<std::atomic<size_type>, _size> _pending;
+    std::array<std::atomic<size_type>, _size> _ready;
+    std::atomic<size_type> _head;
+    std::atomic<size_type> _tail;
+    std::atomic<size_type> _active;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    size_type _generation;
+    bool _is_stopping;
+    std::vector<std::thread> _threads;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- TASK GRAPH: LIFECYCLE -------------------------- //
+// Constructs the graph with one thread per core, the caller being one of them
+template <class... Stages>
+task_graph<type_pack<Stages...>>::task_graph(
+)
+: task_graph(_concurrency())
+{
+}
+
+// Constructs the graph with the given number of threads besides the caller
+template <class... Stages>
+task_graph<type_pack<Stages...>>::task_graph(
+    size_type threads
+)
+: task_graph(threads, Stages()...)
+{
+}
+
+// Constructs the graph from stages and starts the threads of the pool
+template <class... Stages>
+task_graph<type_pack<Stages...>>::task_graph(
+    size_type threads,
+    const Stages&... stages
+)
+: _stages(stages...)
+, _results()
+, _exception()
+, _is_failed(false)
+, _pending()
+, _ready()
+, _head(0)
+, _tail(0)
+, _active(0)
+, _mutex()
+, _condition()
+, _generation(0)
+, _is_stopping(false)
+, _threads()
+{
+    _threads.reserve(threads);
+    for (size_type i = 0; i < threads; ++i) {
+        _threads.emplace_back(&task_graph::_serve, this);
+    }
+}
+
+// Stops and joins the threads of the pool
+template <class... Stages>
+task_graph<type_pack<Stages...>>::~task_graph(
+)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _is_stopping = true;
+    }
+    _condition.notify_all();
+    for (std::thread& thread : _threads) {
+        thread.join();
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- TASK GRAPH: RUN ----------------------------- //
+// Runs each stage once its dependencies are done, and returns the results: if
+// a stage throws, every stage that has not started yet is skipped, whether it
+// depends on the failed one or not, the results are discarded, and the first
+// exception thrown is rethrown once the running stages are done
+template <class... Stages>
+typename task_graph<type_pack<Stages...>>::results_type
+task_graph<type_pack<Stages...>>::run(
+)
+{
+    size_type attempts = 0;
+    for (size_type i = 0; i < _size; ++i) {
+        _pending[i].store(_plan.pending[i], std::memory_order_relaxed);
+        _ready[i].store(_size, std::memory_order_relaxed);
+    }
+    _head.store(0, std::memory_order_relaxed);
+    _tail.store(0, std::memory_order_relaxed);
+    _active.store(_threads.size(), std::memory_order_relaxed);
+    _is_failed.store(false, std::memory_order_relaxed);
+    for (size_type i = 0; i < _plan.roots; ++i) {
+        _push(_plan.order[i]);
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_generation;
+    }
+    _condition.notify_all();
+    _execute(make_pack_index_sequence<_size>{});
+    while (_active.load(std::memory_order_acquire) != 0) {
+        _wait(attempts);
+    }
+    if (_is_failed.load(std::memory_order_relaxed)) {
+        _discard(make_pack_index_sequence<_size>{});
+        std::rethrow_exception(std::exchange(_exception, nullptr));
+    }
+    return _collect(make_pack_index_sequence<_size>{});
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- TASK GRAPH: ACCESS --------------------------- //
+// Returns the stages
+template <class... Stages>
+typename task_graph<type_pack<Stages...>>::stages_type&
+task_graph<type_pack<Stages...>>::stages(
+) noexcept
+{
+    return _stages;
+}
+
+// Returns the stages as immutable
+template <class... Stages>
+const typename task_graph<type_pack<Stages...>>::stages_type&
+task_graph<type_pack<Stages...>>::stages(
+) const noexcept
+{
+    return _stages;
+}
+
+// Returns the indices of the stages in a topological order
+template <class... Stages>
+constexpr const typename task_graph<type_pack<Stages...>>::order_type&
+task_graph<type_pack<Stages...>>::order(
+) noexcept
+{
+    return _plan.order;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- TASK GRAPH: SIZE ---------------------------- //
+// Returns the number of stages
+template <class... Stages>
+constexpr typename task_graph<type_pack<Stages...>>::size_type
+task_graph<type_pack<Stages...>>::size(
+) noexcept
+{
+    return _size;
+}
+
+// Returns the number of threads of the pool besides the caller
+template <class... Stages>
+typename task_graph<type_pack<Stages...>>::size_type
+task_graph<type_pack<Stages...>>::threads(
+) const noexcept
+{
+    return _threads.size();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- TASK GRAPH: IMPLEMENTATION DETAILS ------------------- //
+// Computes the topological order and the dependents of each stage
+template <class... Stages>
+constexpr typename task_graph<type_pack<Stages...>>::_plan_type
+task_graph<type_pack<Stages...>>::_make_plan(
+) noexcept
+{
+    constexpr std::array<const std::size_t*, _size> dependencies = {
+        _node_t<Stages>::indices.data()...
+    };
+    constexpr std::array<std::size_t, _size> counts = {
+        _node_t<Stages>::size...
+    };
+    using table = type_id_table<Stages...>;
+    _plan_type plan = {};
+    std::array<std::size_t, _size> pending = {};
+    std::array<std::size_t, _size> cursors = {};
+    plan.is_complete = true;
+    plan.is_unique = true;
+    for (std::size_t i = 0; i < _size; ++i) {
+        plan.pending[i] = counts[i];
+        plan.is_unique = plan.is_unique && table::is_first(i);
+        for (std::size_t j = 0; j < counts[i]; ++j) {
+            plan.is_complete = plan.is_complete && dependencies[i][j] < _size;
+            if (dependencies[i][j] < _size) {
+                ++plan.offsets[dependencies[i][j] + 1];
+            }
+        }
+    }
+    if (!plan.is_complete) {
+        return plan;
+    }
+    for (std::size_t i = 0; i < _size; ++i) {
+        plan.offsets[i + 1] += plan.offsets[i];
+        cursors[i] = plan.offsets[i];
+        pending[i] = counts[i];
+    }
+    for (std::size_t i = 0; i < _size; ++i) {
+        for (std::size_t j = 0; j < counts[i]; ++j) {
+            plan.dependents[cursors[dependencies[i][j]]++] = i;
+        }
+    }
+    std::size_t size = 0;
+    for (std::size_t i = 0; i < _size; ++i) {
+        if (pending[i] == 0) {
+            plan.order[size++] = i;
+        }
+    }
+    plan.roots = size;
+    for (std::size_t k = 0; k < size; ++k) {
+        const std::size_t i = plan.order[k];
+        for (std::size_t j = plan.offsets[i]; j < plan.offsets[i + 1]; ++j) {
+            if (--pending[plan.dependents[j]] == 0) {
+                plan.order[size++] = plan.dependents[j];
+            }
+        }
+    }
+    plan.is_acyclic = size == _size;
+    return plan;
+}
+
+// Claims ready stages one at a time until all of them have been claimed
+template <class... Stages>
+template <std::size_t... Indices>
+void task_graph<type_pack<Stages...>>::_execute(
+    pack_index_sequence<Indices...>
+)
+{
+    using invoker_type = void (*)(task_graph&);
+    constexpr std::array<invoker_type, _size> invokers = {
+        [](task_graph& graph) {
+            using stage = pack_index_lookup_t<Indices, Stages...>;
+            graph.template _invoke<Indices>(
+                make_pack_index_sequence<_node_t<stage>::size>{}
+            );
+        }...
+    };
+    size_type attempts = 0;
+    size_type position = _head.fetch_add(1, std::memory_order_relaxed);
+    while (position < _size) {
+        const size_type stage = _ready[position].load(
+            std::memory_order_acquire
+        );
+        if (stage == _size) {
+            _wait(attempts);
+            continue;
+        }
+        attempts = 0;
+        invokers[stage](*this);
+        const size_type first = _plan.offsets[stage];
+        const size_type last = _plan.offsets[stage + 1];
+        for (size_type i = first; i < last; ++i) {
+            const size_type next = _plan.dependents[i];
+            if (_pending[next].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                _push(next);
+            }
+        }
+        position = _head.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Calls a stage on the results of its dependencies and stores its result, or
+// the tag of void results: once a stage has thrown, the next ones are skipped
+template <class... Stages>
+template <std::size_t Index, std::size_t... Arguments>
+void task_graph<type_pack<Stages...>>::_invoke(
+    pack_index_sequence<Arguments...>
+)
+{
+    using stage = pack_index_lookup_t<Index, Stages...>;
+    using node = _node_t<stage>;
+    if (_is_failed.load(std::memory_order_acquire)) {
+        return;
+    }
+    try {
+        if constexpr (std::is_same_v<task_result_t<stage>, task_void_t>) {
+            std::invoke(
+                get<Index>(_stages),
+                std::as_const(*get<node::indices[Arguments]>(_results))...
+            );
+            get<Index>(_results).emplace();
+        } else {
+            get<Index>(_results).emplace(std::invoke(
+                get<Index>(_stages),
+                std::as_const(*get<node::indices[Arguments]>(_results))...
+            ));
+        }
+    } catch (...) {
+        if (!_is_failed.exchange(true, std::memory_order_acq_rel)) {
+            _exception = std::current_exception();
+        }
+    }
+}
+
+// Publishes a stage whose dependencies are all done
+template <class... Stages>
+void task_graph<type_pack<Stages...>>::_push(
+    size_type stage
+) noexcept
+{
+    const size_type position = _tail.fetch_add(1, std::memory_order_relaxed);
+    _ready[position].store(stage, std::memory_order_release);
+}
+
+// Runs the loop of a thread of the pool: sleeps between two runs
+template <class... Stages>
+void task_graph<type_pack<Stages...>>::_serve(
+)
+{
+    size_type generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [this, generation] {
+                return _is_stopping || _generation != generation;
+            });
+            if (_is_stopping) {
+                return;
+            }
+            generation = _generation;
+        }
+        _execute(make_pack_index_sequence<_size>{});
+        _active.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+// Moves the results out and leaves the result slots empty
+template <class... Stages>
+template <std::size_t... Indices>
+typename task_graph<type_pack<Stages...>>::results_type
+task_graph<type_pack<Stages...>>::_collect(
+    pack_index_sequence<Indices...>
+)
+{
+    results_type results(std::move(*get<Indices>(_results))...);
+    (get<Indices>(_results).reset(), ...);
+    return results;
+}
+
+// Leaves the result slots empty, discarding the results
+template <class... Stages>
+template <std::size_t... Indices>
+void task_graph<type_pack<Stages...>>::_discard(
+    pack_index_sequence<Indices...>
+) noexcept
+{
+    (get<Indices>(_results).reset(), ...);
+}
+
+// Returns the number of cores besides the one of the caller
+template <class... Stages>
+typename task_graph<type_pack<Stages...>>::size_type
+task_graph<type_pack<Stages...>>::_concurrency(
+) noexcept
+{
+    const size_type cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 0;
+}
+
+// Waits for the other threads, spinning first then yielding the core
+template <class... Stages>
+void task_graph<type_pack<Stages...>>::_wait(
+    size_type& attempts
+)
+{
+    if (++attempts > _spins) {
+        std::this_thread::yield();
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _TASK_GRAPH_HPP_INCLUDED
+// ========================================================================== //
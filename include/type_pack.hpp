@@ -35,7 +35,7 @@ class type_pack_element
     using type = Type;
     using index_type = Index;
     using key_type = Key;
-    static constexpr auto index = index_type::value;
+    static constexpr std::size_t index = index_type::value;
 
     // Lifecycle
     public:
@@ -63,9 +63,31 @@ template <std::size_t... Indices, class... Types>
 class type_pack_base<pack_index_sequence<Indices...>, Types...>
 : type_pack_element<Types, pack_index<Indices>>...
 {
-    // Inheritance
+    // Access
     public:
-    using type_pack_element<Types, pack_index<Indices>>::operator[]...;
+    template <std::size_t Index>
+    constexpr auto operator[](pack_index<Index>) const noexcept;
+    template <class Key>
+    constexpr auto operator[](Key&&) const noexcept;
+
+    // Implementation details: element lookup, deduced from a single base
+    private:
+    template <std::size_t Index, class Type, class Key>
+    static constexpr auto _at(
+        const type_pack_element<Type, pack_index<Index>, Key>&
+    ) noexcept;
+
+    // Implementation details: key lookup in unevaluated contexts, an exact key
+    // deducing a single base, and any other key being resolved as an overload
+    private:
+    template <class Key, class Type, class Index>
+    static Index _find(const volatile type_pack_element<
+        Type, Index, std::remove_reference_t<Key>
+    >*);
+    template <class Key>
+    static pack_key_table<
+        Key, pack_index_sequence<Indices...>, Types...
+    > _find(const volatile void*);
 
     // Implementation details: types and constants
     private:
@@ -160,6 +182,47 @@ type_pack_element<Type, Index, Key>::operator[](
 
 
 
+// ------------------------- TYPE PACK BASE: ACCESS ------------------------- //
+// Returns the type pack element corresponding to the index
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index>
+constexpr auto
+type_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    pack_index<Index>
+) const noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Returns the type pack element corresponding to the key
+template <std::size_t... Indices, class... Types>
+template <class Key>
+constexpr auto
+type_pack_base<pack_index_sequence<Indices...>, Types...>::operator[](
+    Key&&
+) const noexcept
+{
+    return _at<decltype(_find<Key>(this))::value>(*this);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------- TYPE PACK BASE: IMPLEMENTATION DETAILS ----------------- //
+// Returns the element at the index, the only base that can be deduced
+template <std::size_t... Indices, class... Types>
+template <std::size_t Index, class Type, class Key>
+constexpr auto
+type_pack_base<pack_index_sequence<Indices...>, Types...>::_at(
+    const type_pack_element<Type, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // -------------------------- TYPE PACK: LIFECYCLE -------------------------- //
 // Explicitly constructs a type pack from objects of these types
 template <class... Types>
@@ -0,0 +1,150 @@
+// ============================= TYPE REGISTRY ============================== //
+// Project:         Pack
+// Name:            type_registry.hpp
+// Description:     Dense compile-time identifiers of the types of a pack
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _TYPE_REGISTRY_HPP_INCLUDED
+#define _TYPE_REGISTRY_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "type_pack.hpp"
+#include "pack_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ***************************** TYPE REGISTRY ****************************** */
+// Type registry class declaration
+template <class Types>
+class type_registry;
+
+// Type registry class definition: each type is identified by its index in
+// the pack, stored in the smallest unsigned integer type, so that ids can
+// index arrays and dispatch through tables instead of run-time type info
+template <class... Types>
+class type_registry<type_pack<Types...>>
+{
+    // Types
+    public:
+    using size_type = std::size_t;
+    using id_type = std::conditional_t<
+        (sizeof...(Types) <= 0x100),
+        std::uint8_t,
+        std::conditional_t<
+            (sizeof...(Types) <= 0x10000),
+            std::uint16_t,
+            std::uint32_t
+        >
+    >;
+    template <id_type Id>
+    using type_at = pack_index_lookup_t<Id, Types...>;
+
+    // Implementation details: identifiers
+    private:
+    static_assert(
+        std::is_same_v<
+            decltype(unique(type_pack<Types...>{})),
+            type_pack<Types...>
+        >,
+        "the types should be registered only once"
+    );
+    template <class Type>
+    static constexpr id_type _id() noexcept;
+
+    // Constants
+    public:
+    template <class Type>
+    static constexpr bool contains = type_id_table<Types...>::find(
+        &type_tag<Type>
+    ) < sizeof...(Types);
+    template <class Type>
+    static constexpr id_type id_of = _id<Type>();
+
+    // Visitation
+    public:
+    template <class Function>
+    static constexpr decltype(auto) visit(id_type, Function&&);
+
+    // Size
+    public:
+    static constexpr size_type size() noexcept;
+};
+/* ************************************************************************** */
+
+
+
+// ----------------------- TYPE REGISTRY: VISITATION ------------------------ //
+// Calls a function on the type id of the type with the given id, through a
+// table of functions indexed by id: the id should be lower than the size
+template <class... Types>
+template <class Function>
+constexpr decltype(auto) type_registry<type_pack<Types...>>::visit(
+    id_type id,
+    Function&& function
+)
+{
+    using result = decltype(std::declval<Function&&>()(
+        type_id<pack_index_lookup_t<0, Types...>>{}
+    ));
+    using pointer = result (*)(Function&&);
+    constexpr pointer table[] = {[](Function&& f) -> result {
+        return std::forward<Function>(f)(type_id<Types>{});
+    }...};
+    return table[id](std::forward<Function>(function));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- TYPE REGISTRY: SIZE --------------------------- //
+// Returns the number of registered types
+template <class... Types>
+constexpr typename type_registry<type_pack<Types...>>::size_type
+type_registry<type_pack<Types...>>::size(
+) noexcept
+{
+    return sizeof...(Types);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------- TYPE REGISTRY: IMPLEMENTATION DETAILS ------------------ //
+// Returns the id of a type, failing to compile if it is not registered
+template <class... Types>
+template <class Type>
+constexpr typename type_registry<type_pack<Types...>>::id_type
+type_registry<type_pack<Types...>>::_id(
+) noexcept
+{
+    constexpr size_type index = type_id_table<Types...>::find(
+        &type_tag<Type>
+    );
+    static_assert(index < sizeof...(Types), "the type should be registered");
+    return static_cast<id_type>(index);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _TYPE_REGISTRY_HPP_INCLUDED
+// ========================================================================== //
@@ -57,7 +57,7 @@ class type_template_pack_element
     using index_type = Index;
     template <class... Types>
     using key_type = Key<Types...>;
-    static constexpr auto index = index_type::value;
+    static constexpr std::size_t index = index_type::value;
 
     // Lifecycle
     public:
@@ -101,12 +101,31 @@ class type_template_pack_base<
 >
 : type_template_pack_element<Templates, pack_index<Indices>>...
 {
-    // Inheritance
+    // Access
     public:
-    using type_template_pack_element<
-        Templates,
-        pack_index<Indices>
-    >::operator[]...;
+    template <std::size_t Index>
+    constexpr auto operator[](pack_index<Index>) const noexcept;
+    template <template <class...> class K, class... Args>
+    constexpr auto operator[](const K<Args...>&) const noexcept;
+
+    // Implementation details: element lookup, deduced from a single base
+    private:
+    template <
+        std::size_t Index,
+        template <class...> class Template,
+        template <class...> class Key
+    >
+    static constexpr auto _at(
+        const type_template_pack_element<Template, pack_index<Index>, Key>&
+    ) noexcept;
+    template <
+        template <class...> class Key,
+        template <class...> class Template,
+        class Index
+    >
+    static constexpr auto _find(
+        const type_template_pack_element<Template, Index, Key>&
+    ) noexcept;
 
     // Implementation details: types and constants
     private:
@@ -252,6 +271,70 @@ type_template_pack_element<Template, Index, Key>::operator[](
 
 
 
+// -------------------- TYPE TEMPLATE PACK BASE: ACCESS --------------------- //
+// Returns the type template pack element corresponding to the index
+template <std::size_t... Indices, template <class...> class... Templates>
+template <std::size_t Index>
+constexpr auto
+type_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+operator[](
+    pack_index<Index>
+) const noexcept
+{
+    return _at<Index>(*this);
+}
+
+// Returns the type template pack element corresponding to the key
+template <std::size_t... Indices, template <class...> class... Templates>
+template <template <class...> class K, class... Args>
+constexpr auto
+type_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+operator[](
+    const K<Args...>&
+) const noexcept
+{
+    return _find<K>(*this);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------ TYPE TEMPLATE PACK BASE: IMPLEMENTATION DETAILS ------------- //
+// Returns the element at the index, the only base that can be deduced
+template <std::size_t... Indices, template <class...> class... Templates>
+template <
+    std::size_t Index,
+    template <class...> class Template,
+    template <class...> class Key
+>
+constexpr auto
+type_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+_at(
+    const type_template_pack_element<Template, pack_index<Index>, Key>& base
+) noexcept
+{
+    return base;
+}
+
+// Returns the element of the key, deduction failing for duplicate keys
+template <std::size_t... Indices, template <class...> class... Templates>
+template <
+    template <class...> class Key,
+    template <class...> class Template,
+    class Index
+>
+constexpr auto
+type_template_pack_base<pack_index_sequence<Indices...>, Templates...>::
+_find(
+    const type_template_pack_element<Template, Index, Key>& base
+) noexcept
+{
+    return base;
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ---------------------- TYPE TEMPLATE PACK: LIFECYCLE --------------------- //
 // Explicitly constructs a template pack from objects of these types
 template <template <class...> class... Templates>
@@ -0,0 +1,311 @@
+// ================================ ZIP SORT ================================ //
+// Project:         Pack
+// Name:            zip_sort.hpp
+// Description:     Sorting of several ranges in lockstep
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _ZIP_SORT_HPP_INCLUDED
+#define _ZIP_SORT_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <climits>
+#include <iterator>
+// Project sources
+#include "pack_details.hpp"
+#include "reference_pack.hpp"
+#include "zip_view.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ******************************* ZIP SORTER ******************************* */
+// Zip sorter class definition: sorts rows by their first element
+template <class... Iterators>
+class zip_sorter
+{
+    // Types and constants
+    public:
+    using iterator = zip_iterator<Iterators...>;
+    using difference_type = typename iterator::difference_type;
+    using key_type = typename std::iterator_traits<
+        std::tuple_element_t<0, std::tuple<Iterators...>>
+    >::value_type;
+    static constexpr bool is_radix_sortable = std::is_integral_v<key_type>
+    && !std::is_same_v<std::remove_cv_t<key_type>, bool>;
+
+    // Sort
+    public:
+    static constexpr void sort(iterator, iterator);
+    static constexpr void introsort(iterator, iterator);
+    static constexpr void heapsort(iterator, iterator);
+    static constexpr void insertion_sort(iterator, iterator);
+    static constexpr void radix_sort(iterator, iterator);
+
+    // Implementation details: constants
+    private:
+    static constexpr difference_type _threshold = 16;
+    static constexpr unsigned int _radix_bits = CHAR_BIT;
+    static constexpr std::size_t _radix_size = std::size_t(1) << _radix_bits;
+
+    // Implementation details: sort
+    private:
+    static constexpr decltype(auto) _key(const iterator&);
+    static constexpr void _introsort(iterator, iterator, difference_type);
+    static constexpr void _sift_down(
+        iterator,
+        difference_type,
+        difference_type
+    );
+    static constexpr std::size_t _digit(const key_type&, unsigned int);
+    static constexpr void _radix_sort(iterator, iterator, unsigned int);
+};
+/* ************************************************************************** */
+
+
+
+/* ******************************** SORT ZIP ******************************** */
+// Sort zip declaration
+template <class KeyRange, class... PayloadRanges>
+constexpr void sort_zip(KeyRange&, PayloadRanges&...);
+/* ************************************************************************** */
+
+
+
+// --------------------------- ZIP SORTER: SORT ----------------------------- //
+// Sorts the rows, through a radix sort for integral keys
+template <class... Iterators>
+constexpr void zip_sorter<Iterators...>::sort(
+    iterator first,
+    iterator last
+)
+{
+    if constexpr (is_radix_sortable) {
+        radix_sort(first, last);
+    } else {
+        introsort(first, last);
+    }
+}
+
+// Sorts the rows through an introspective sort
+template <class... Iterators>
+constexpr void zip_sorter<Iterators...>::introsort(
+    iterator first,
+    iterator last
+)
+{
+    difference_type depth = 0;
+    for (difference_type size = last - first; size > 1; size >>= 1) {
+        depth += 2;
+    }
+    _introsort(first, last, depth);
+}
+
+// Sorts the rows through a heap sort
+template <class... Iterators>
+constexpr void zip_sorter<Iterators...>::heapsort(
+    iterator first,
+    iterator last
+)
+{
+    const difference_type size = last - first;
+    for (difference_type root = size / 2; root > 0; --root) {
+        _sift_down(first, root - 1, size);
+    }
+    for (difference_type end = size - 1; end > 0; --end) {
+        iter_swap(first, first + end);
+        _sift_down(first, 0, end);
+    }
+}
+
+// Sorts the rows through an insertion sort, efficient on small ranges
+template <class... Iterators>
+constexpr void zip_sorter<Iterators...>::insertion_sort(
+    iterator first,
+    iterator last
+)
+{
+    for (iterator i = first; i != last; ++i) {
+        for (iterator j = i; j != first && _key(j) < _key(j - 1); --j) {
+            iter_swap(j, j - 1);
+        }
+    }
+}
+
+// Sorts the rows through an in-place most significant digit radix sort
+template <class... Iterators>
+constexpr void zip_sorter<Iterators...>::radix_sort(
+    iterator first,
+    iterator last
+)
+{
+    static_assert(is_radix_sortable, "radix sort requires integral keys");
+    _radix_sort(first, last, (sizeof(key_type) - 1) * _radix_bits);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- ZIP SORTER: IMPLEMENTATION DETAILS ------------------- //
+// Returns a reference to the key of the row pointed to by the iterator
+template <class... Iterators>
+constexpr decltype(auto) zip_sorter<Iterators...>::_key(
+    const iterator& it
+)
+{
+    return get<0>(*it);
+}
+
+// Sorts through quicksort partitions until the depth limit is reached
+template <class... Iterators>
+constexpr void zip_sorter<Iterators...>::_introsort(
+    iterator first,
+    iterator last,
+    difference_type depth
+)
+{
+    while (last - first > _threshold) {
+        if (depth-- == 0) {
+            heapsort(first, last);
+            return;
+        }
+        iterator middle = first + (last - first) / 2;
+        if (_key(middle) < _key(first)) iter_swap(middle, first);
+        if (_key(last - 1) < _key(first)) iter_swap(last - 1, first);
+        if (_key(last - 1) < _key(middle)) iter_swap(last - 1, middle);
+        iter_swap(first, middle);
+        const auto& pivot = _key(first);
+        iterator i = first;
+        iterator j = last;
+        while (true) {
+            do ++i; while (i < last - 1 && _key(i) < pivot);
+            do --j; while (pivot < _key(j));
+            if (i >= j) break;
+            iter_swap(i, j);
+        }
+        iter_swap(first, j);
+        if (j - first < last - j) {
+            _introsort(first, j, depth);
+            first = j + 1;
+        } else {
+            _introsort(j + 1, last, depth);
+            last = j;
+        }
+    }
+    insertion_sort(first, last);
+}
+
+// Restores the heap property below the root
+template <class... Iterators>
+constexpr void zip_sorter<Iterators...>::_sift_down(
+    iterator first,
+    difference_type root,
+    difference_type size
+)
+{
+    for (difference_type child = 2 * root + 1; child < size; ) {
+        if (child + 1 < size && _key(first + child) < _key(first + child + 1)) {
+            ++child;
+        }
+        if (!(_key(first + root) < _key(first + child))) break;
+        iter_swap(first + root, first + child);
+        root = child;
+        child = 2 * root + 1;
+    }
+}
+
+// Returns the digit of a key at the given shift, ordering signed keys
+template <class... Iterators>
+constexpr std::size_t zip_sorter<Iterators...>::_digit(
+    const key_type& key,
+    unsigned int shift
+)
+{
+    using unsigned_type = std::make_unsigned_t<key_type>;
+    constexpr unsigned int bits = sizeof(key_type) * CHAR_BIT;
+    unsigned_type value = static_cast<unsigned_type>(key);
+    if constexpr (std::is_signed_v<key_type>) {
+        value ^= static_cast<unsigned_type>(unsigned_type(1) << (bits - 1));
+    }
+    return static_cast<std::size_t>(value >> shift) & (_radix_size - 1);
+}
+
+// Distributes the rows into digit buckets in place, and recurses into them
+template <class... Iterators>
+constexpr void zip_sorter<Iterators...>::_radix_sort(
+    iterator first,
+    iterator last,
+    unsigned int shift
+)
+{
+    if (last - first <= _threshold) {
+        insertion_sort(first, last);
+        return;
+    }
+    std::array<difference_type, _radix_size> begins = {};
+    std::array<difference_type, _radix_size> ends = {};
+    for (iterator it = first; it != last; ++it) {
+        ++ends[_digit(_key(it), shift)];
+    }
+    for (std::size_t digit = 1; digit < _radix_size; ++digit) {
+        begins[digit] = ends[digit - 1];
+        ends[digit] += ends[digit - 1];
+    }
+    std::array<difference_type, _radix_size> nexts = begins;
+    for (std::size_t digit = 0; digit < _radix_size; ++digit) {
+        while (nexts[digit] < ends[digit]) {
+            const iterator it = first + nexts[digit];
+            const std::size_t other = _digit(_key(it), shift);
+            if (other == digit) {
+                ++nexts[digit];
+            } else {
+                iter_swap(it, first + nexts[other]++);
+            }
+        }
+    }
+    if (shift >= _radix_bits) {
+        for (std::size_t digit = 0; digit < _radix_size; ++digit) {
+            if (ends[digit] - begins[digit] > 1) {
+                _radix_sort(
+                    first + begins[digit],
+                    first + ends[digit],
+                    shift - _radix_bits
+                );
+            }
+        }
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------------- SORT ZIP -------------------------------- //
+// Sorts ranges in lockstep by the keys of the first one, swapping rows
+template <class KeyRange, class... PayloadRanges>
+constexpr void sort_zip(
+    KeyRange& keys,
+    PayloadRanges&... payloads
+)
+{
+    const auto view = zip(keys, payloads...);
+    zip_sorter<
+        zip_range_iterator_t<KeyRange>,
+        zip_range_iterator_t<PayloadRanges>...
+    >::sort(view.begin(), view.end());
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _ZIP_SORT_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,668 @@
+// ================================ ZIP VIEW ================================ //
+// Project:         Pack
+// Name:            zip_view.hpp
+// Description:     A view iterating over several ranges in lockstep
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _ZIP_VIEW_HPP_INCLUDED
+#define _ZIP_VIEW_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+// Project sources
+#include "pack_details.hpp"
+#include "pack_index.hpp"
+#include "object_pack.hpp"
+#include "reference_pack.hpp"
+#include "pack_tuple.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace pck {
+// ========================================================================== //
+
+
+
+/* ************************** ZIP RANGE ITERATOR **************************** */
+// Zip range iterator structure definition: iterators of generic ranges
+template <class Range, class = void>
+struct zip_range_iterator
+{
+    using type = decltype(std::begin(std::declval<Range&>()));
+    static constexpr type first(Range& range);
+};
+
+// Zip range iterator structure specialization: pointers of contiguous ranges
+template <class Range>
+struct zip_range_iterator<
+    Range,
+    std::void_t<decltype(std::data(std::declval<Range&>()))>
+>
+{
+    using type = decltype(std::data(std::declval<Range&>()));
+    static constexpr type first(Range& range);
+};
+
+// Alias template
+template <class Range>
+using zip_range_iterator_t = typename zip_range_iterator<Range>::type;
+/* ************************************************************************** */
+
+
+
+/* ****************************** ZIP ITERATOR ****************************** */
+// Zip iterator class definition
+template <class... Iterators>
+class zip_iterator
+{
+    // Types
+    public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = object_pack<
+        typename std::iterator_traits<Iterators>::value_type...
+    >;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = reference_pack<
+        typename std::iterator_traits<Iterators>::reference...
+    >;
+
+    // Lifecycle
+    public:
+    constexpr zip_iterator() = default;
+    constexpr zip_iterator(const object_pack<Iterators...>&, difference_type);
+
+    // Access
+    public:
+    constexpr reference operator*() const;
+    constexpr reference operator[](difference_type) const;
+
+    // Increment and decrement
+    public:
+    constexpr zip_iterator& operator++() noexcept;
+    constexpr zip_iterator operator++(int) noexcept;
+    constexpr zip_iterator& operator--() noexcept;
+    constexpr zip_iterator operator--(int) noexcept;
+
+    // Arithmetic
+    public:
+    constexpr zip_iterator& operator+=(difference_type) noexcept;
+    constexpr zip_iterator& operator-=(difference_type) noexcept;
+    constexpr zip_iterator operator+(difference_type) const noexcept;
+    constexpr zip_iterator operator-(difference_type) const noexcept;
+    constexpr difference_type operator-(const zip_iterator&) const noexcept;
+
+    // Comparison
+    public:
+    constexpr bool operator==(const zip_iterator&) const noexcept;
+    constexpr bool operator!=(const zip_iterator&) const noexcept;
+    constexpr bool operator<(const zip_iterator&) const noexcept;
+    constexpr bool operator>(const zip_iterator&) const noexcept;
+    constexpr bool operator<=(const zip_iterator&) const noexcept;
+    constexpr bool operator>=(const zip_iterator&) const noexcept;
+
+    // Implementation details: data members
+    private:
+    object_pack<Iterators...> _first;
+    difference_type _index;
+};
+/* ************************************************************************** */
+
+
+
+/* ************************ ZIP ITERATOR: ARITHMETIC ************************ */
+// Zip iterator offset declaration
+template <class... Iterators>
+constexpr zip_iterator<Iterators...> operator+(
+    typename zip_iterator<Iterators...>::difference_type,
+    const zip_iterator<Iterators...>&
+) noexcept;
+/* ************************************************************************** */
+
+
+
+/* *************************** ZIP ITERATOR: SWAP *************************** */
+// Zip iterator swap declaration
+template <class... Iterators>
+constexpr void iter_swap(
+    const zip_iterator<Iterators...>&,
+    const zip_iterator<Iterators...>&
+);
+/* ************************************************************************** */
+
+
+
+/* ******************************** ZIP VIEW ******************************** */
+// Zip view class definition
+template <class... Iterators>
+class zip_view
+{
+    // Implementation details: type traits
+    private:
+    static constexpr bool _is_contiguous_v
+    = (std::is_pointer_v<Iterators> && ...);
+
+    // Types
+    public:
+    using iterator = zip_iterator<Iterators...>;
+    using value_type = typename iterator::value_type;
+    using reference = typename iterator::reference;
+    using size_type = std::size_t;
+    using difference_type = typename iterator::difference_type;
+
+    // Lifecycle
+    public:
+    constexpr zip_view(size_type, const Iterators&...);
+
+    // Iterators
+    public:
+    constexpr iterator begin() const;
+    constexpr iterator end() const;
+
+    // Access
+    public:
+    constexpr reference operator[](size_type) const;
+    template <bool Contiguous = _is_contiguous_v>
+    constexpr std::enable_if_t<Contiguous, object_pack<Iterators...>> data(
+    ) const noexcept;
+
+    // Size
+    public:
+    constexpr size_type size() const noexcept;
+
+    // Loop
+    public:
+    template <class Function>
+    constexpr void for_each(Function&&) const;
+
+    // Implementation details: loops
+    private:
+    template <class Function, class... Types>
+    static constexpr void _loop(Function&, size_type, Types*...);
+    template <class Function, class... Types>
+    static constexpr void _loop_disjoint(
+        Function&,
+        size_type,
+        Types* __restrict...
+    );
+    template <class Function, class... Its>
+    static constexpr void _loop(Function&, size_type, Its...);
+    template <class... Types>
+    static constexpr bool _overlap(size_type, const Types*...) noexcept;
+
+    // Implementation details: data members
+    private:
+    object_pack<Iterators...> _first;
+    size_type _size;
+};
+/* ************************************************************************** */
+
+
+
+/* ********************************** ZIP *********************************** */
+// Zip declaration
+template <class... Ranges>
+constexpr auto zip(Ranges&...);
+/* ************************************************************************** */
+
+
+
+// ---------------------- ZIP RANGE ITERATOR: ACCESS ------------------------ //
+// Returns an iterator to the first element of a generic range
+template <class Range, class Void>
+constexpr typename zip_range_iterator<Range, Void>::type
+zip_range_iterator<Range, Void>::first(
+    Range& range
+)
+{
+    return std::begin(range);
+}
+
+// Returns a pointer to the first element of a contiguous range
+template <class Range>
+constexpr typename zip_range_iterator<
+    Range,
+    std::void_t<decltype(std::data(std::declval<Range&>()))>
+>::type zip_range_iterator<
+    Range,
+    std::void_t<decltype(std::data(std::declval<Range&>()))>
+>::first(
+    Range& range
+)
+{
+    return std::data(range);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ ZIP ITERATOR: LIFECYCLE ------------------------- //
+// Constructs a zip iterator from the first iterators and an index
+template <class... Iterators>
+constexpr zip_iterator<Iterators...>::zip_iterator(
+    const object_pack<Iterators...>& first,
+    difference_type index
+)
+: _first(first)
+, _index(index)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- ZIP ITERATOR: ACCESS -------------------------- //
+// Returns the row of references the iterator points to
+template <class... Iterators>
+constexpr typename zip_iterator<Iterators...>::reference
+zip_iterator<Iterators...>::operator*(
+) const
+{
+    return operator[](0);
+}
+
+// Returns the row of references at the given offset
+template <class... Iterators>
+constexpr typename zip_iterator<Iterators...>::reference
+zip_iterator<Iterators...>::operator[](
+    difference_type offset
+) const
+{
+    return pck::apply([this, offset](const Iterators&... first) {
+        return reference(first[_index + offset]...);
+    }, _first);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------- ZIP ITERATOR: INCREMENT AND DECREMENT ------------------ //
+// Pre-increments the iterator
+template <class... Iterators>
+constexpr zip_iterator<Iterators...>& zip_iterator<Iterators...>::operator++(
+) noexcept
+{
+    ++_index;
+    return *this;
+}
+
+// Post-increments the iterator
+template <class... Iterators>
+constexpr zip_iterator<Iterators...> zip_iterator<Iterators...>::operator++(
+    int
+) noexcept
+{
+    zip_iterator result = *this;
+    ++_index;
+    return result;
+}
+
+// Pre-decrements the iterator
+template <class... Iterators>
+constexpr zip_iterator<Iterators...>& zip_iterator<Iterators...>::operator--(
+) noexcept
+{
+    --_index;
+    return *this;
+}
+
+// Post-decrements the iterator
+template <class... Iterators>
+constexpr zip_iterator<Iterators...> zip_iterator<Iterators...>::operator--(
+    int
+) noexcept
+{
+    zip_iterator result = *this;
+    --_index;
+    return result;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ ZIP ITERATOR: ARITHMETIC ------------------------ //
+// Advances the iterator by the given offset
+template <class... Iterators>
+constexpr zip_iterator<Iterators...>& zip_iterator<Iterators...>::operator+=(
+    difference_type offset
+) noexcept
+{
+    _index += offset;
+    return *this;
+}
+
+// Moves the iterator back by the given offset
+template <class... Iterators>
+constexpr zip_iterator<Iterators...>& zip_iterator<Iterators...>::operator-=(
+    difference_type offset
+) noexcept
+{
+    _index -= offset;
+    return *this;
+}
+
+// Returns an iterator advanced by the given offset
+template <class... Iterators>
+constexpr zip_iterator<Iterators...> zip_iterator<Iterators...>::operator+(
+    difference_type offset
+) const noexcept
+{
+    return zip_iterator(_first, _index + offset);
+}
+
+// Returns an iterator moved back by the given offset
+template <class... Iterators>
+constexpr zip_iterator<Iterators...> zip_iterator<Iterators...>::operator-(
+    difference_type offset
+) const noexcept
+{
+    return zip_iterator(_first, _index - offset);
+}
+
+// Returns the distance between two iterators
+template <class... Iterators>
+constexpr typename zip_iterator<Iterators...>::difference_type
+zip_iterator<Iterators...>::operator-(
+    const zip_iterator& other
+) const noexcept
+{
+    return _index - other._index;
+}
+
+// Returns an iterator advanced by the given offset
+template <class... Iterators>
+constexpr zip_iterator<Iterators...> operator+(
+    typename zip_iterator<Iterators...>::difference_type offset,
+    const zip_iterator<Iterators...>& iterator
+) noexcept
+{
+    return iterator + offset;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ ZIP ITERATOR: COMPARISON ------------------------ //
+// Checks whether two iterators point to the same row
+template <class... Iterators>
+constexpr bool zip_iterator<Iterators...>::operator==(
+    const zip_iterator& other
+) const noexcept
+{
+    return _index == other._index;
+}
+
+// Checks whether two iterators point to different rows
+template <class... Iterators>
+constexpr bool zip_iterator<Iterators...>::operator!=(
+    const zip_iterator& other
+) const noexcept
+{
+    return _index != other._index;
+}
+
+// Checks whether the iterator points before the other one
+template <class... Iterators>
+constexpr bool zip_iterator<Iterators...>::operator<(
+    const zip_iterator& other
+) const noexcept
+{
+    return _index < other._index;
+}
+
+// Checks whether the iterator points after the other one
+template <class... Iterators>
+constexpr bool zip_iterator<Iterators...>::operator>(
+    const zip_iterator& other
+) const noexcept
+{
+    return _index > other._index;
+}
+
+// Checks whether the iterator does not point after the other one
+template <class... Iterators>
+constexpr bool zip_iterator<Iterators...>::operator<=(
+    const zip_iterator& other
+) const noexcept
+{
+    return _index <= other._index;
+}
+
+// Checks whether the iterator does not point before the other one
+template <class... Iterators>
+constexpr bool zip_iterator<Iterators...>::operator>=(
+    const zip_iterator& other
+) const noexcept
+{
+    return _index >= other._index;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- ZIP ITERATOR: SWAP --------------------------- //
+// Swaps the rows pointed to by two iterators without temporary packs, column
+// by column, the trivially relocatable elements being swapped as bytes
+template <class... Iterators>
+constexpr void iter_swap(
+    const zip_iterator<Iterators...>& lhs,
+    const zip_iterator<Iterators...>& rhs
+)
+{
+    typename zip_iterator<Iterators...>::reference left = *lhs;
+    typename zip_iterator<Iterators...>::reference right = *rhs;
+    pck::apply([&right](auto&... lefts) {
+        pck::apply([&lefts...](auto&... rights) {
+            (relocating_swap(lefts, rights), ...);
+        }, right);
+    }, left);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- ZIP VIEW: LIFECYCLE --------------------------- //
+// Constructs a zip view from a size and the first iterators of the ranges
+template <class... Iterators>
+constexpr zip_view<Iterators...>::zip_view(
+    size_type size,
+    const Iterators&... first
+)
+: _first(first...)
+, _size(size)
+{
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- ZIP VIEW: ITERATORS --------------------------- //
+// Returns an iterator to the first row
+template <class... Iterators>
+constexpr typename zip_view<Iterators...>::iterator
+zip_view<Iterators...>::begin(
+) const
+{
+    return iterator(_first, 0);
+}
+
+// Returns an iterator past the last row
+template <class... Iterators>
+constexpr typename zip_view<Iterators...>::iterator
+zip_view<Iterators...>::end(
+) const
+{
+    return iterator(_first, static_cast<difference_type>(_size));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- ZIP VIEW: ACCESS ---------------------------- //
+// Returns the row of references at the given position
+template <class... Iterators>
+constexpr typename zip_view<Iterators...>::reference
+zip_view<Iterators...>::operator[](
+    size_type position
+) const
+{
+    return begin()[static_cast<difference_type>(position)];
+}
+
+// Returns the pointers to the first elements of contiguous ranges
+template <class... Iterators>
+template <bool Contiguous>
+constexpr std::enable_if_t<Contiguous, object_pack<Iterators...>>
+zip_view<Iterators...>::data(
+) const noexcept
+{
+    return _first;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------------- ZIP VIEW: SIZE ----------------------------- //
+// Returns the number of rows, that is the size of the shortest range
+template <class... Iterators>
+constexpr typename zip_view<Iterators...>::size_type
+zip_view<Iterators...>::size(
+) const noexcept
+{
+    return _size;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------------- ZIP VIEW: LOOP ----------------------------- //
+// Calls a function on every row: contiguous ranges that do not overlap are
+// looped over through restricted pointers, so that the loop can be vectorized
+template <class... Iterators>
+template <class Function>
+constexpr void zip_view<Iterators...>::for_each(
+    Function&& function
+) const
+{
+    pck::apply([&](const Iterators&... first) {
+        _loop(function, _size, first...);
+    }, _first);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- ZIP VIEW: IMPLEMENTATION DETAILS --------------------- //
+// Loops over contiguous ranges, through restricted pointers if they are
+// disjoint, and as generic ranges otherwise
+template <class... Iterators>
+template <class Function, class... Types>
+constexpr void zip_view<Iterators...>::_loop(
+    Function& function,
+    size_type size,
+    Types*... first
+)
+{
+    if (_overlap(size, first...)) {
+        for (size_type i = 0; i < size; ++i) {
+            function(reference_pack<Types&...>(first[i]...));
+        }
+    } else {
+        _loop_disjoint(function, size, first...);
+    }
+}
+
+// Loops over non-aliasing contiguous ranges, letting the compiler vectorize
+template <class... Iterators>
+template <class Function, class... Types>
+constexpr void zip_view<Iterators...>::_loop_disjoint(
+    Function& function,
+    size_type size,
+    Types* __restrict... first
+)
+{
+    for (size_type i = 0; i < size; ++i) {
+        function(reference_pack<Types&...>(first[i]...));
+    }
+}
+
+// Loops over generic random access ranges
+template <class... Iterators>
+template <class Function, class... Its>
+constexpr void zip_view<Iterators...>::_loop(
+    Function& function,
+    size_type size,
+    Its... first
+)
+{
+    for (size_type i = 0; i < size; ++i) {
+        function(reference(first[i]...));
+    }
+}
+
+// Checks whether two of the contiguous ranges of the given size overlap
+template <class... Iterators>
+template <class... Types>
+constexpr bool zip_view<Iterators...>::_overlap(
+    size_type size,
+    const Types*... first
+) noexcept
+{
+    constexpr size_type count = sizeof...(Types);
+    const std::array<const void*, count> begins = {first...};
+    const std::array<const void*, count> ends = {(first + size)...};
+    const std::less<const void*> less;
+    for (size_type i = 0; i < count; ++i) {
+        for (size_type j = i + 1; j < count; ++j) {
+            if (less(begins[i], ends[j]) && less(begins[j], ends[i])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------- ZIP ----------------------------------- //
+// Zips ranges into a view whose rows are reference packs
+template <class... Ranges>
+constexpr auto zip(
+    Ranges&... ranges
+)
+{
+    static_assert(sizeof...(Ranges) > 0, "at least one range should be zipped");
+    static_assert(
+        pack_conjunction_v<std::is_base_of_v<
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<
+                zip_range_iterator_t<Ranges>
+            >::iterator_category
+        >...>,
+        "the ranges should be random access"
+    );
+    const std::size_t size = std::min({static_cast<std::size_t>(
+        std::distance(std::begin(ranges), std::end(ranges))
+    )...});
+    return zip_view<zip_range_iterator_t<Ranges>...>(
+        size,
+        zip_range_iterator<Ranges>::first(ranges)...
+    );
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace pck
+#endif // _ZIP_VIEW_HPP_INCLUDED
+// ========================================================================== //
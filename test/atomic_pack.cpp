@@ -0,0 +1,158 @@
+// ============================ ATOMIC PACK TEST ============================ //
+// Project:         Pack
+// Name:            atomic_pack.cpp
+// Description:     Tests of the small packs updated as a single word
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ------------------------ ATOMIC PACK TEST: TYPES ------------------------- //
+// A pack fitting in 64 bits, and another needing 128 bits: the latter links
+// against libatomic unless cmpxchg16b is enabled with -mcx16
+using narrow = atomic_pack<std::int32_t, std::int16_t, char>;
+using wide = atomic_pack<std::uint64_t, std::uint32_t, std::uint32_t>;
+
+// Increments the elements of a pack of counters
+struct increment
+{
+    template <class Pack>
+    void operator()(Pack& pack) const {
+        ++get<0>(pack);
+        ++get<1>(pack);
+        get<2>(pack) += 2;
+    }
+};
+
+// Returns whether the elements of two packs of three elements are equal
+template <class Pack>
+bool equal(const Pack& lhs, const Pack& rhs)
+{
+    return get<0>(lhs) == get<0>(rhs)
+        && get<1>(lhs) == get<1>(rhs)
+        && get<2>(lhs) == get<2>(rhs);
+}
+
+// Returns whether the elements of a pack of counters were updated together
+template <class Pack>
+bool is_consistent(const Pack& pack)
+{
+    return static_cast<std::uint64_t>(get<0>(pack)) == get<1>(pack)
+        && 2 * static_cast<std::uint64_t>(get<1>(pack)) == get<2>(pack);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- ATOMIC PACK TEST: OPERATIONS ---------------------- //
+// Loads, stores and exchanges all the elements at once
+void test_operations()
+{
+    static_assert(narrow::size() == 3 && wide::size() == 3);
+    static_assert(narrow::is_always_lock_free());
+    narrow x;
+    assert(equal(x.load(), narrow::value_type(0, 0, 0)) && x.is_lock_free());
+    x.store(narrow::value_type(1, 2, 'a'));
+    assert(equal(x.load(), narrow::value_type(1, 2, 'a')));
+    const auto previous = x.exchange(narrow::value_type(-1, -2, 'b'));
+    assert(equal(previous, narrow::value_type(1, 2, 'a')));
+    const auto current = x.load(std::memory_order_acquire);
+    assert(equal(current, narrow::value_type(-1, -2, 'b')));
+    wide y(wide::value_type(1, 2, 3));
+    assert(equal(y.load(), wide::value_type(1, 2, 3)));
+    y.store(wide::value_type(~0ULL, 5, 6), std::memory_order_release);
+    const auto last = y.exchange(wide::value_type(7, 8, 9));
+    assert(equal(last, wide::value_type(~0ULL, 5, 6)));
+    assert(equal(y.load(), wide::value_type(7, 8, 9)));
+}
+
+// Replaces the elements only when they all equal the expected ones, and
+// otherwise reports the current ones
+void test_compare_exchange()
+{
+    narrow x(narrow::value_type(1, 2, 'a'));
+    auto expected = narrow::value_type(1, 3, 'a');
+    assert(!x.compare_exchange_strong(expected, narrow::value_type(0, 0, 0)));
+    assert(equal(expected, narrow::value_type(1, 2, 'a')));
+    assert(x.compare_exchange_strong(expected, narrow::value_type(4, 5, 'c')));
+    assert(equal(x.load(), narrow::value_type(4, 5, 'c')));
+    wide y(wide::value_type(1, 2, 3));
+    auto current = wide::value_type(1, 2, 4);
+    assert(!y.compare_exchange_strong(current, wide::value_type(0, 0, 0)));
+    assert(equal(current, wide::value_type(1, 2, 3)));
+    while (!y.compare_exchange_weak(current, wide::value_type(5, 6, 7))) {
+    }
+    assert(equal(y.load(), wide::value_type(5, 6, 7)));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ ATOMIC PACK TEST: UPDATE ------------------------ //
+// Never lets readers see a partial update of the elements by several writers
+template <class Atomic>
+void test_update()
+{
+    constexpr std::size_t writers = 3;
+    constexpr std::size_t updates = 10000;
+    Atomic counters;
+    std::atomic<bool> done = false;
+    std::atomic<bool> consistent = true;
+    std::thread reader([&] {
+        while (!done.load()) {
+            consistent = consistent && is_consistent(counters.load());
+            std::this_thread::yield();
+        }
+    });
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < writers; ++i) {
+        threads.emplace_back([&counters] {
+            for (std::size_t j = 0; j < updates; ++j) {
+                const auto value = counters.update(increment());
+                assert(is_consistent(value));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    done = true;
+    reader.join();
+    const auto value = counters.load();
+    assert(consistent.load() && is_consistent(value));
+    assert(static_cast<std::size_t>(get<0>(value)) == writers * updates);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- ATOMIC PACK TEST: MAIN ------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_operations();
+    test_compare_exchange();
+    test_update<atomic_pack<std::int32_t, std::uint16_t, std::uint16_t>>();
+    test_update<wide>();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
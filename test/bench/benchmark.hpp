@@ -0,0 +1,80 @@
+// =============================== BENCHMARK ================================ //
+// Project:         Pack
+// Name:            benchmark.hpp
+// Description:     Timing and reporting utilities shared by the benchmarks
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BENCHMARK_HPP_INCLUDED
+#define _BENCHMARK_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <chrono>
+#include <limits>
+#include <cstdio>
+#include <cstddef>
+#include <algorithm>
+// Project sources
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// --------------------------- BENCHMARK: TIMING ---------------------------- //
+// Makes the compiler assume that a value is read and written, so that the
+// computations producing it are not optimized away
+template <class Type>
+inline void keep(Type& value) noexcept
+{
+    asm volatile("" : : "r"(&value) : "memory");
+}
+
+// Returns the shortest time in seconds of several runs of a function
+template <class Function>
+double measure(std::size_t runs, Function&& function)
+{
+    double best = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < runs; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const std::chrono::duration<double> elapsed = (
+            std::chrono::steady_clock::now() - start
+        );
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- BENCHMARK: REPORTING -------------------------- //
+// Prints the title of a group of measurements
+inline void section(const char* title)
+{
+    std::printf("%s\n", title);
+}
+
+// Prints the time per operation and the number of operations per second
+inline void report(const char* name, std::size_t operations, double seconds)
+{
+    std::printf(
+        "    %-36s %10.2f ns/op %10.2f Mop/s\n",
+        name,
+        seconds * 1e9 / operations,
+        operations / seconds / 1e6
+    );
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _BENCHMARK_HPP_INCLUDED
+// ========================================================================== //
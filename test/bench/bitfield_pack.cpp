@@ -0,0 +1,162 @@
+// ======================== BITFIELD PACK BENCHMARK ========================= //
+// Project:         Pack
+// Name:            bitfield_pack.cpp
+// Description:     Scans, updates and bulk reads of records of small fields
+//                  packed in bitfield packs, against a structure of uint8_t
+//                  and uint16_t members
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cstdio>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+// Project sources
+#include "../../include/pack.hpp"
+#include "benchmark.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// --------------------- BITFIELD PACK BENCHMARK: TYPES --------------------- //
+// The flags of a packet: a 3-bit class, a 5-bit hop count, a 4-bit priority
+// and a 12-bit channel, in one 32-bit word
+using packed = bitfield_pack<nontype_pack<3, 5, 4, 12>>;
+
+// The same flags in the smallest integer members holding them
+struct plain
+{
+    std::uint8_t kind;
+    std::uint8_t hops;
+    std::uint8_t priority;
+    std::uint16_t channel;
+};
+
+// Accesses the fields of both records in the same way
+inline std::uint16_t channel(const packed& x) noexcept
+{
+    return x.get<3>();
+}
+inline std::uint16_t channel(const plain& x) noexcept
+{
+    return x.channel;
+}
+inline void increment_hops(packed& x) noexcept
+{
+    x.set<1>(x.get<1>() + 1);
+}
+inline void increment_hops(plain& x) noexcept
+{
+    x.hops = (x.hops + 1) & 31;
+}
+
+// Number of records, and of runs of each benchmark
+inline constexpr std::size_t count = 1 << 22;
+inline constexpr std::size_t runs = 10;
+
+// Returns records whose fields are derived from their position
+template <class Record>
+std::vector<Record> make_records()
+{
+    std::vector<Record> records(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const packed::value_type value(i % 8, i % 32, i % 16, i % 4096);
+        if constexpr (std::is_same_v<Record, packed>) {
+            records[i].pack(value);
+        } else {
+            records[i] = plain{
+                get<0>(value), get<1>(value), get<2>(value), get<3>(value)
+            };
+        }
+    }
+    return records;
+}
+
+// Returns the time to sum the channel of every record
+template <class Record>
+double scan(std::vector<Record>& records)
+{
+    return measure(runs, [&records] {
+        std::uint64_t total = 0;
+        for (const Record& record : records) {
+            total += channel(record);
+        }
+        keep(total);
+    });
+}
+
+// Returns the time to increment the hop count of every record
+template <class Record>
+double update(std::vector<Record>& records)
+{
+    return measure(runs, [&records] {
+        for (Record& record : records) {
+            increment_hops(record);
+        }
+        keep(records);
+    });
+}
+
+// Returns the time to read all the fields of every packed record at once
+double unpack(std::vector<packed>& records)
+{
+    return measure(runs, [&records] {
+        std::uint64_t total = 0;
+        for (const packed& record : records) {
+            const packed::value_type value = record.unpack();
+            total += get<0>(value) + get<1>(value);
+            total += get<2>(value) + get<3>(value);
+        }
+        keep(total);
+    });
+}
+
+// Returns the time to read all the fields of every plain record
+double unpack(std::vector<plain>& records)
+{
+    return measure(runs, [&records] {
+        std::uint64_t total = 0;
+        for (const plain& record : records) {
+            total += record.kind + record.hops;
+            total += record.priority + record.channel;
+        }
+        keep(total);
+    });
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- BITFIELD PACK BENCHMARK: MAIN ---------------------- //
+// Runs the benchmarks
+int main(int, char*[])
+{
+    std::vector<packed> packed_records = make_records<packed>();
+    std::vector<plain> plain_records = make_records<plain>();
+    std::printf(
+        "record size: bitfield_pack %zu bytes, struct %zu bytes\n",
+        sizeof(packed),
+        sizeof(plain)
+    );
+    section("sum of a 12-bit field, per record");
+    report("bitfield_pack", count, scan(packed_records));
+    report("uint8_t and uint16_t struct", count, scan(plain_records));
+    section("increment of a 5-bit field, per record");
+    report("bitfield_pack", count, update(packed_records));
+    report("uint8_t and uint16_t struct", count, update(plain_records));
+    section("sum of all the fields, per record");
+    report("bitfield_pack", count, unpack(packed_records));
+    report("uint8_t and uint16_t struct", count, unpack(plain_records));
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,236 @@
+// ======================== MESSAGE QUEUE BENCHMARK ========================= //
+// Project:         Pack
+// Name:            message_queue.cpp
+// Description:     Throughput of several producers and a consumer exchanging
+//                  messages stored inline, one by one or by blocks, against
+//                  messages boxed into a locked queue
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <deque>
+#include <mutex>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+// Project sources
+#include "../../include/pack.hpp"
+#include "benchmark.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// --------------------- MESSAGE QUEUE BENCHMARK: TYPES --------------------- //
+// Messages of a trading feed
+struct quote
+{
+    double price;
+    std::uint64_t volume;
+};
+struct order
+{
+    std::uint64_t id;
+    std::uint32_t quantity;
+    char side;
+};
+struct cancel
+{
+    std::uint64_t id;
+};
+using queue = message_queue<type_pack<quote, order, cancel>>;
+
+// Adds the fields of the messages it is called on to a total
+struct summing
+{
+    void operator()(const quote& x) {total += x.volume;}
+    void operator()(const order& x) {total += x.id + x.quantity;}
+    void operator()(const cancel& x) {total += x.id;}
+    std::uint64_t total;
+};
+
+// The messages boxed behind a common base, as before message queues
+struct message
+{
+    virtual ~message() = default;
+    virtual void apply(summing&) const = 0;
+};
+template <class Message>
+struct boxed
+: message
+{
+    explicit boxed(const Message& value): value(value) {}
+    void apply(summing& sum) const override {sum(value);}
+    Message value;
+};
+
+// A queue of boxed messages protected by a mutex
+struct locked_queue
+{
+    void push(std::unique_ptr<message> value) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        messages.push_back(std::move(value));
+    }
+    std::unique_ptr<message> pop() {
+        const std::lock_guard<std::mutex> lock(mutex);
+        std::unique_ptr<message> value;
+        if (!messages.empty()) {
+            value = std::move(messages.front());
+            messages.pop_front();
+        }
+        return value;
+    }
+    std::mutex mutex;
+    std::deque<std::unique_ptr<message>> messages;
+};
+
+// Number of messages, split among the producers, of messages per block, and
+// of runs of each benchmark
+inline constexpr std::size_t count = 1 << 20;
+inline constexpr std::size_t block = 32;
+inline constexpr std::size_t runs = 3;
+
+// Returns the time for producers to hand all the messages to one consumer,
+// yielding whenever they cannot make progress
+template <class Produce, class Consume>
+double exchange(std::size_t producers, Produce produce, Consume consume)
+{
+    return measure(runs, [producers, &produce, &consume] {
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < producers; ++i) {
+            threads.emplace_back(produce, count / producers);
+        }
+        summing sum{0};
+        for (std::size_t received = 0; received < count;) {
+            const std::size_t size = consume(sum);
+            received += size;
+            if (size == 0) {
+                std::this_thread::yield();
+            }
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        keep(sum);
+    });
+}
+
+// Returns the time to exchange the messages one by one through the queue
+double single(std::size_t producers)
+{
+    queue messages;
+    return exchange(
+        producers,
+        [&messages](std::size_t size) {
+            for (std::size_t i = 0; i < size; ++i) {
+                const bool is_pushed = (
+                    i % 3 == 0 ? messages.try_push(quote{1.5, i})
+                    : i % 3 == 1 ? messages.try_push(order{i, 10, 'b'})
+                    : messages.try_push(cancel{i})
+                );
+                if (!is_pushed) {
+                    std::this_thread::yield();
+                    --i;
+                }
+            }
+        },
+        [&messages](summing& sum) -> std::size_t {
+            return messages.try_pop(sum);
+        }
+    );
+}
+
+// Returns the time to exchange the messages by blocks through the queue
+double blocks(std::size_t producers)
+{
+    queue messages;
+    return exchange(
+        producers,
+        [&messages](std::size_t size) {
+            std::array<order, block> orders = {};
+            for (std::size_t i = 0; i < size; i += block) {
+                for (std::size_t j = 0; j < block; ++j) {
+                    orders[j] = order{i + j, 10, 'b'};
+                }
+                auto first = orders.begin();
+                while (first != orders.end()) {
+                    first = messages.try_push_n(first, orders.end());
+                    if (first != orders.end()) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        },
+        [&messages](summing& sum) {
+            return messages.try_pop_n(sum, block);
+        }
+    );
+}
+
+// Returns the time to exchange boxed messages through the locked queue
+double locked(std::size_t producers)
+{
+    locked_queue messages;
+    return exchange(
+        producers,
+        [&messages](std::size_t size) {
+            for (std::size_t i = 0; i < size; ++i) {
+                if (i % 3 == 0) {
+                    messages.push(std::make_unique<boxed<quote>>(
+                        quote{1.5, i}
+                    ));
+                } else if (i % 3 == 1) {
+                    messages.push(std::make_unique<boxed<order>>(
+                        order{i, 10, 'b'}
+                    ));
+                } else {
+                    messages.push(std::make_unique<boxed<cancel>>(cancel{i}));
+                }
+            }
+        },
+        [&messages](summing& sum) -> std::size_t {
+            const std::unique_ptr<message> value = messages.pop();
+            if (value) {
+                value->apply(sum);
+            }
+            return value != nullptr;
+        }
+    );
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- MESSAGE QUEUE BENCHMARK: MAIN ---------------------- //
+// Runs the benchmarks
+int main(int, char*[])
+{
+    const unsigned int threads = std::thread::hardware_concurrency();
+    std::printf("hardware threads: %u\n", threads);
+    char title[64] = {};
+    for (std::size_t producers : {1, 2, 4}) {
+        std::snprintf(
+            title,
+            sizeof(title),
+            "producers: %zu, consumer: 1, per message",
+            producers
+        );
+        section(title);
+        report("message_queue, one by one", count, single(producers));
+        report("message_queue, blocks of 32", count, blocks(producers));
+        report("boxed messages, locked deque", count, locked(producers));
+    }
+    return 0;
+}
+// -------------------------------------------------------------------------- //
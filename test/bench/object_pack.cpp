@@ -0,0 +1,93 @@
+// ========================= OBJECT PACK BENCHMARK ========================== //
+// Project:         Pack
+// Name:            object_pack.cpp
+// Description:     Growth of vectors of object packs, moved or relocated as
+//                  bytes when their elements allow it
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <tuple>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+// Project sources
+#include "../../include/pack.hpp"
+#include "benchmark.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ---------------------- OBJECT PACK BENCHMARK: TYPES ---------------------- //
+// A record whose move constructor may throw, as the elements of object packs
+// before their special members propagated noexcept: vectors copy it to grow
+struct throwing_record
+{
+    throwing_record(std::string name, int value)
+    : name(std::move(name)), value(value) {}
+    throwing_record(const throwing_record&) = default;
+    throwing_record(throwing_record&& other) noexcept(false)
+    : name(std::move(other.name)), value(other.value) {}
+    std::string name;
+    int value;
+};
+
+// Packs moved, and relocated as bytes, when vectors grow
+using record = object_pack<std::string, int>;
+using point = object_pack<int, double>;
+static_assert(std::is_nothrow_move_constructible_v<record>);
+static_assert(!std::is_nothrow_move_constructible_v<throwing_record>);
+static_assert(std::is_trivial_v<point> && is_trivially_relocatable_v<point>);
+static_assert(!std::is_trivial_v<std::tuple<int, double>>);
+
+// Number of elements appended to the vectors, and of runs of each benchmark
+inline constexpr std::size_t count = 1 << 20;
+inline constexpr std::size_t runs = 5;
+
+// Returns the time to append elements to a vector without reserving it
+template <class Type, class Function>
+double grow(Function make)
+{
+    return measure(runs, [&make] {
+        std::vector<Type> values;
+        for (std::size_t i = 0; i < count; ++i) {
+            values.emplace_back(make(i));
+        }
+        keep(values);
+    });
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- OBJECT PACK BENCHMARK: MAIN ----------------------- //
+// Runs the benchmarks
+int main(int, char*[])
+{
+    const std::string name(32, 'x');
+    section("vector growth, strings out of the small buffer");
+    report("object_pack<std::string, int>", count, grow<record>(
+        [&name](std::size_t i) {return record(name, int(i));}
+    ));
+    report("throwing move constructor", count, grow<throwing_record>(
+        [&name](std::size_t i) {return throwing_record(name, int(i));}
+    ));
+    section("vector growth, trivial elements");
+    report("object_pack<int, double>", count, grow<point>(
+        [](std::size_t i) {return point(int(i), double(i));}
+    ));
+    report("std::tuple<int, double>", count, grow<std::tuple<int, double>>(
+        [](std::size_t i) {return std::tuple<int, double>(i, i);}
+    ));
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,108 @@
+// ========================== PACK BATCH BENCHMARK ========================== //
+// Project:         Pack
+// Name:            pack_batch.cpp
+// Description:     Throughput of kernels handed records by blocks of 4, 8, 16
+//                  and 64 rows, against one record at a time
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <vector>
+#include <cstddef>
+// Project sources
+#include "../../include/pack.hpp"
+#include "benchmark.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ---------------------- PACK BATCH BENCHMARK: TYPES ----------------------- //
+// Records of the ingest path
+using record = object_pack<float, float, float>;
+
+// Number of records, not a multiple of the block sizes to exercise the tail,
+// and of runs of each benchmark
+inline constexpr std::size_t count = (1 << 20) + 3;
+inline constexpr std::size_t runs = 20;
+
+// Evaluates a polynomial of the first field, and adds the second one, into
+// the third field of the records
+struct polynomial
+{
+    static constexpr float apply(float x, float y) noexcept {
+        float value = 0.f;
+        for (float coefficient : coefficients) {
+            value = value * x + coefficient;
+        }
+        return value + y;
+    }
+    template <std::size_t Size>
+    void operator()(batch<Size, float, float, float>& block) const {
+        for (std::size_t i = 0; i < Size; ++i) {
+            get<2>(block)[i] = apply(get<0>(block)[i], get<1>(block)[i]);
+        }
+    }
+    template <class Row>
+    void operator()(Row&& row) const {
+        get<2>(row) = apply(get<0>(row), get<1>(row));
+    }
+    static constexpr float coefficients[] = {
+        0.5f, -1.f, 0.25f, 2.f, -0.75f, 1.5f, 0.125f, -2.f
+    };
+};
+
+// Processes one record, as the ingest path does, through a call per record
+[[gnu::noinline]] void process(record& row)
+{
+    polynomial()(row);
+}
+
+// Returns the time to hand all the records to the kernel by blocks
+template <std::size_t Size>
+double blocks(std::vector<record>& records)
+{
+    return measure(runs, [&records] {
+        for_each_batch<Size>(records, polynomial());
+        keep(records);
+    });
+}
+
+// Returns the time to hand the records to the kernel one at a time
+double rows(std::vector<record>& records)
+{
+    return measure(runs, [&records] {
+        for (record& row : records) {
+            process(row);
+        }
+        keep(records);
+    });
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK BATCH BENCHMARK: MAIN ----------------------- //
+// Runs the benchmarks
+int main(int, char*[])
+{
+    std::vector<record> records(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        records[i] = record(float(i % 13) / 13.f, float(i % 7), 0.f);
+    }
+    section("records processed, per record");
+    report("one at a time", count, rows(records));
+    report("for_each_batch<4>", count, blocks<4>(records));
+    report("for_each_batch<8>", count, blocks<8>(records));
+    report("for_each_batch<16>", count, blocks<16>(records));
+    report("for_each_batch<64>", count, blocks<64>(records));
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,113 @@
+// ======================== PACK PIPELINE BENCHMARK ========================= //
+// Project:         Pack
+// Name:            pack_pipeline.cpp
+// Description:     Messages per second through pipelines of stages on their
+//                  own threads, against a single-threaded loop
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cstdio>
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+#include <numeric>
+// Project sources
+#include "../../include/pack.hpp"
+#include "benchmark.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// --------------------- PACK PIPELINE BENCHMARK: TYPES --------------------- //
+// Mixes the bits of an integer a given number of times
+inline std::uint64_t mix(std::uint64_t x, std::size_t rounds) noexcept
+{
+    for (std::size_t i = 0; i < rounds; ++i) {
+        x ^= x >> 31;
+        x *= 0x7FB5D329728EA185ULL;
+        x ^= x >> 27;
+    }
+    return x;
+}
+
+// Stages of an ingest pipeline, doing some work on each message
+struct decode {
+    using input_type = std::uint32_t;
+    using output_type = std::uint64_t;
+    std::uint64_t operator()(std::uint32_t x) const {return mix(x, 16);}
+};
+struct enrich {
+    using input_type = std::uint64_t;
+    using output_type = std::uint64_t;
+    std::uint64_t operator()(std::uint64_t x) const {return mix(x, 64);}
+};
+struct encode {
+    using input_type = std::uint64_t;
+    using output_type = std::uint64_t;
+    std::uint64_t operator()(std::uint64_t x) const {return mix(x, 16);}
+};
+
+// Pipelines of the stages, the most expensive one being replicated or not
+using stages = pipeline<type_pack<decode, enrich, encode>>;
+using replicated_stages = pipeline<
+    type_pack<decode, replicated<enrich, 2>, encode>
+>;
+
+// Number of messages, and of runs of each benchmark
+inline constexpr std::size_t count = 1 << 18;
+inline constexpr std::size_t runs = 5;
+
+// Returns the time to run the stages one after the other on each message
+double loop(const std::vector<std::uint32_t>& inputs)
+{
+    std::vector<std::uint64_t> outputs(inputs.size());
+    return measure(runs, [&inputs, &outputs] {
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            outputs[i] = encode()(enrich()(decode()(inputs[i])));
+        }
+        keep(outputs);
+    });
+}
+
+// Returns the time to stream the messages through a pipeline
+template <class Pipeline>
+double stream(const std::vector<std::uint32_t>& inputs)
+{
+    std::vector<std::uint64_t> outputs(inputs.size());
+    Pipeline pipeline;
+    return measure(runs, [&inputs, &outputs, &pipeline] {
+        pipeline.run(inputs.begin(), inputs.end(), outputs.begin());
+        keep(outputs);
+    });
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- PACK PIPELINE BENCHMARK: MAIN ---------------------- //
+// Runs the benchmarks
+int main(int, char*[])
+{
+    std::vector<std::uint32_t> inputs(count);
+    std::iota(inputs.begin(), inputs.end(), 0);
+    section("messages streamed through three stages, per message");
+    const unsigned int threads = std::thread::hardware_concurrency();
+    std::printf("    hardware threads: %u\n", threads);
+    report("single-threaded loop", count, loop(inputs));
+    report("pipeline, one thread per stage", count, stream<stages>(inputs));
+    report("pipeline, replicated enrich stage", count, stream<
+        replicated_stages
+    >(inputs));
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,146 @@
+// ========================== PACK POOL BENCHMARK =========================== //
+// Project:         Pack
+// Name:            pack_pool.cpp
+// Description:     Churn of small objects of a dozen types through a pack
+//                  pool, against new and delete and a standard pool resource
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <memory_resource>
+// Project sources
+#include "../../include/pack.hpp"
+#include "benchmark.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ----------------------- PACK POOL BENCHMARK: TYPES ----------------------- //
+// An object of the given size
+template <std::size_t Size>
+struct object
+{
+    explicit object(std::size_t value) noexcept {
+        bytes[0] = static_cast<unsigned char>(value);
+    }
+    unsigned char bytes[Size];
+};
+
+// A dozen types of small objects
+using types = type_pack<
+    object<8>, object<16>, object<24>, object<32>, object<40>, object<48>,
+    object<64>, object<80>, object<96>, object<128>, object<192>, object<256>
+>;
+
+// Number of live objects of each type, of rounds replacing an object of each
+// type, and of runs of each benchmark
+inline constexpr std::size_t live = 1024;
+inline constexpr std::size_t rounds = 1 << 18;
+inline constexpr std::size_t runs = 3;
+
+// Creates and destroys objects with new and delete
+struct heap
+{
+    template <class Type>
+    Type* create(std::size_t value) {
+        return new Type(value);
+    }
+    template <class Type>
+    void destroy(Type* pointer) noexcept {
+        delete pointer;
+    }
+};
+
+// Creates and destroys objects in a standard unsynchronized pool resource
+struct resource
+{
+    template <class Type>
+    Type* create(std::size_t value) {
+        return ::new (pool.allocate(sizeof(Type), alignof(Type))) Type(value);
+    }
+    template <class Type>
+    void destroy(Type* pointer) noexcept {
+        pointer->~Type();
+        pool.deallocate(pointer, sizeof(Type), alignof(Type));
+    }
+    std::pmr::unsynchronized_pool_resource pool;
+};
+
+// Creates and destroys objects in a pack pool
+struct pooled
+{
+    template <class Type>
+    Type* create(std::size_t value) {
+        return pool.create<Type>(value);
+    }
+    template <class Type>
+    void destroy(Type* pointer) noexcept {
+        pool.destroy(pointer);
+    }
+    pack_pool<types> pool;
+};
+
+// Returns the time to replace live objects of each type at random positions
+template <class Allocator, class... Types, std::size_t... Indices>
+double churn(type_pack<Types...>, std::index_sequence<Indices...>)
+{
+    Allocator allocator;
+    object_pack<std::array<Types*, live>...> objects;
+    (get<Indices>(objects).fill(nullptr), ...);
+    const double seconds = measure(runs, [&allocator, &objects] {
+        std::uint64_t state = 1;
+        for (std::size_t i = 0; i < rounds; ++i) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            const std::size_t index = state >> 54;
+            (..., [&allocator, &objects, index] {
+                Types*& pointer = get<Indices>(objects)[index];
+                if (pointer) {
+                    allocator.destroy(pointer);
+                }
+                pointer = allocator.template create<Types>(index);
+            }());
+        }
+        keep(objects);
+    });
+    (..., [&allocator, &objects] {
+        for (auto* pointer : get<Indices>(objects)) {
+            if (pointer) {
+                allocator.destroy(pointer);
+            }
+        }
+    }());
+    return seconds;
+}
+template <class Allocator>
+double churn()
+{
+    return churn<Allocator>(types{}, std::make_index_sequence<types::size()>{});
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK POOL BENCHMARK: MAIN ------------------------ //
+// Runs the benchmarks
+int main(int, char*[])
+{
+    constexpr std::size_t operations = rounds * types::size();
+    section("objects of 12 types replaced, per replacement");
+    report("new and delete", operations, churn<heap>());
+    report("unsynchronized_pool_resource", operations, churn<resource>());
+    report("pack_pool", operations, churn<pooled>());
+    return 0;
+}
+// -------------------------------------------------------------------------- //
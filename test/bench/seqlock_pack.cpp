@@ -0,0 +1,127 @@
+// ========================= SEQLOCK PACK BENCHMARK ========================= //
+// Project:         Pack
+// Name:            seqlock_pack.cpp
+// Description:     Reads of a dozen fields written by one thread, by 1 to 64
+//                  readers, through a seqlock pack against a shared mutex
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <mutex>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <shared_mutex>
+// Project sources
+#include "../../include/pack.hpp"
+#include "benchmark.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// --------------------- SEQLOCK PACK BENCHMARK: TYPES ---------------------- //
+// The market data state, a dozen fields written by one thread, protected by
+// a seqlock
+using sequenced = seqlock_pack<
+    double, double, double, double,
+    std::uint64_t, std::uint64_t, std::uint64_t, std::uint64_t,
+    std::uint32_t, std::uint32_t, std::uint16_t, char
+>;
+using state = sequenced::value_type;
+
+// Returns the state derived from a number
+state make_state(std::uint64_t number)
+{
+    return state(
+        number * .5, number * .25, number * 2., number * 4.,
+        number, number + 1, number + 2, number + 3,
+        std::uint32_t(number), std::uint32_t(number + 1),
+        std::uint16_t(number), static_cast<char>(number % 128)
+    );
+}
+
+// The state protected by a reader-writer lock
+struct locked
+{
+    state load() const {
+        const std::shared_lock<std::shared_mutex> lock(mutex);
+        return value;
+    }
+    void store(const state& x) {
+        const std::lock_guard<std::shared_mutex> lock(mutex);
+        value = x;
+    }
+    mutable std::shared_mutex mutex;
+    state value;
+};
+
+// Number of reads, split among the readers, and of runs of each benchmark
+inline constexpr std::size_t count = 1 << 20;
+inline constexpr std::size_t runs = 3;
+
+// Returns the time for readers to load the state while a writer stores it
+template <class Shared>
+double read(std::size_t readers)
+{
+    Shared shared;
+    return measure(runs, [&shared, readers] {
+        std::atomic<bool> is_done = false;
+        std::thread writer([&shared, &is_done] {
+            for (std::uint64_t i = 0; !is_done.load(); ++i) {
+                shared.store(make_state(i));
+                std::this_thread::yield();
+            }
+        });
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < readers; ++i) {
+            threads.emplace_back([&shared, readers] {
+                std::uint64_t total = 0;
+                for (std::size_t j = 0; j < count / readers; ++j) {
+                    total += get<4>(shared.load());
+                }
+                keep(total);
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        is_done = true;
+        writer.join();
+    });
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- SEQLOCK PACK BENCHMARK: MAIN ---------------------- //
+// Runs the benchmarks
+int main(int, char*[])
+{
+    const unsigned int threads = std::thread::hardware_concurrency();
+    std::printf("hardware threads: %u\n", threads);
+    char title[64] = {};
+    for (std::size_t readers = 1; readers <= 64; readers *= 2) {
+        std::snprintf(
+            title,
+            sizeof(title),
+            "readers: %zu, writer: 1, per read",
+            readers
+        );
+        section(title);
+        report("seqlock_pack", count, read<sequenced>(readers));
+        report("std::shared_mutex", count, read<locked>(readers));
+    }
+    return 0;
+}
+// -------------------------------------------------------------------------- //
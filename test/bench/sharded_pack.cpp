@@ -0,0 +1,124 @@
+// ========================= SHARDED PACK BENCHMARK ========================= //
+// Project:         Pack
+// Name:            sharded_pack.cpp
+// Description:     Counters updated by 1 to 8 threads through a sharded pack,
+//                  against shared atomic counters incremented with fetch_add
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+// Project sources
+#include "../../include/pack.hpp"
+#include "benchmark.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// --------------------- SHARDED PACK BENCHMARK: TYPES ---------------------- //
+// The counters of a server: requests, bytes and errors, sharded per thread
+using sharded = sharded_pack<std::uint64_t, std::uint64_t, std::uint64_t>;
+
+// The same counters, shared by all the threads
+struct shared
+{
+    void update(std::uint64_t size) noexcept {
+        requests.fetch_add(1, std::memory_order_relaxed);
+        bytes.fetch_add(size, std::memory_order_relaxed);
+        errors.fetch_add(size % 64 == 0, std::memory_order_relaxed);
+    }
+    std::uint64_t aggregate() const noexcept {
+        return requests.load() + bytes.load() + errors.load();
+    }
+    std::atomic<std::uint64_t> requests = 0;
+    std::atomic<std::uint64_t> bytes = 0;
+    std::atomic<std::uint64_t> errors = 0;
+};
+
+// Number of updates, split among the threads, and of runs of each benchmark
+inline constexpr std::size_t count = 1 << 22;
+inline constexpr std::size_t runs = 3;
+
+// Returns the time for threads to update the counters through a sharded pack
+double sharding(std::size_t threads)
+{
+    sharded counters;
+    return measure(runs, [&counters, threads] {
+        std::vector<std::thread> workers;
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers.emplace_back([&counters, threads] {
+                for (std::uint64_t j = 0; j < count / threads; ++j) {
+                    counters.update([j](auto& value) {
+                        get<0>(value) += 1;
+                        get<1>(value) += j;
+                        get<2>(value) += j % 64 == 0;
+                    });
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        auto total = counters.aggregate();
+        keep(total);
+    });
+}
+
+// Returns the time for threads to update the shared atomic counters
+double atomics(std::size_t threads)
+{
+    shared counters;
+    return measure(runs, [&counters, threads] {
+        std::vector<std::thread> workers;
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers.emplace_back([&counters, threads] {
+                for (std::uint64_t j = 0; j < count / threads; ++j) {
+                    counters.update(j);
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        auto total = counters.aggregate();
+        keep(total);
+    });
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- SHARDED PACK BENCHMARK: MAIN ---------------------- //
+// Runs the benchmarks
+int main(int, char*[])
+{
+    const unsigned int threads = std::thread::hardware_concurrency();
+    std::printf("hardware threads: %u\n", threads);
+    char title[64] = {};
+    for (std::size_t writers = 1; writers <= 8; writers *= 2) {
+        std::snprintf(
+            title,
+            sizeof(title),
+            "writers: %zu, per update of three counters",
+            writers
+        );
+        section(title);
+        report("sharded_pack", count, sharding(writers));
+        report("std::atomic, fetch_add", count, atomics(writers));
+    }
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,130 @@
+// ========================== TASK GRAPH BENCHMARK ========================== //
+// Project:         Pack
+// Name:            task_graph.cpp
+// Description:     Requests run as a small graph of stages on the thread pool
+//                  of a task graph, against std::async and a sequential call
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cstdio>
+#include <future>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+// Project sources
+#include "../../include/pack.hpp"
+#include "benchmark.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ---------------------- TASK GRAPH BENCHMARK: TYPES ----------------------- //
+// Mixes the bits of an integer a given number of times
+inline std::uint64_t mix(std::uint64_t x, std::size_t rounds) noexcept
+{
+    for (std::size_t i = 0; i < rounds; ++i) {
+        x ^= x >> 31;
+        x *= 0x7FB5D329728EA185ULL;
+        x ^= x >> 27;
+    }
+    return x;
+}
+
+// Stages of a request: two independent stages between a first and a last one
+struct parse {
+    std::uint64_t operator()() const {return mix(request, 256);}
+    std::uint64_t request;
+};
+struct lookup {
+    using depends_on = type_pack<parse>;
+    std::uint64_t operator()(std::uint64_t x) const {return mix(x, 1024);}
+};
+struct score {
+    using depends_on = type_pack<parse>;
+    std::uint64_t operator()(std::uint64_t x) const {return mix(x + 1, 1024);}
+};
+struct merge {
+    using depends_on = type_pack<lookup, score>;
+    std::uint64_t operator()(std::uint64_t x, std::uint64_t y) const {
+        return mix(x ^ y, 256);
+    }
+};
+using graph = task_graph<type_pack<parse, lookup, score, merge>>;
+
+// Number of requests, and of runs of each benchmark
+inline constexpr std::size_t count = 1 << 12;
+inline constexpr std::size_t runs = 5;
+
+// Returns the time to run the stages of each request one after the other
+double sequential()
+{
+    return measure(runs, [] {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint64_t parsed = parse{i}();
+            total += merge()(lookup()(parsed), score()(parsed));
+        }
+        keep(total);
+    });
+}
+
+// Returns the time to run the independent stages of each request with async
+double async()
+{
+    return measure(runs, [] {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint64_t parsed = parse{i}();
+            std::future<std::uint64_t> looked_up = std::async(
+                std::launch::async,
+                [parsed] {return lookup()(parsed);}
+            );
+            std::future<std::uint64_t> scored = std::async(
+                std::launch::async,
+                [parsed] {return score()(parsed);}
+            );
+            total += merge()(looked_up.get(), scored.get());
+        }
+        keep(total);
+    });
+}
+
+// Returns the time to run each request on the thread pool of a task graph
+double pooled()
+{
+    graph stages;
+    return measure(runs, [&stages] {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            get<0>(stages.stages()).request = i;
+            total += get<3>(stages.run());
+        }
+        keep(total);
+    });
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- TASK GRAPH BENCHMARK: MAIN ----------------------- //
+// Runs the benchmarks
+int main(int, char*[])
+{
+    section("requests of four stages, per request");
+    const unsigned int threads = std::thread::hardware_concurrency();
+    std::printf("    hardware threads: %u\n", threads);
+    report("sequential calls", count, sequential());
+    report("std::async", count, async());
+    report("task_graph", count, pooled());
+    return 0;
+}
+// -------------------------------------------------------------------------- //
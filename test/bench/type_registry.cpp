@@ -0,0 +1,166 @@
+// ======================== TYPE REGISTRY BENCHMARK ========================= //
+// Project:         Pack
+// Name:            type_registry.cpp
+// Description:     Dispatch on stored type identifiers and per-type counters
+//                  through a type registry, against an unordered map keyed by
+//                  std::type_index
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <typeinfo>
+#include <typeindex>
+#include <unordered_map>
+// Project sources
+#include "../../include/pack.hpp"
+#include "benchmark.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// --------------------- TYPE REGISTRY BENCHMARK: TYPES --------------------- //
+// An event of the given size
+template <std::size_t Size>
+struct event
+{
+    unsigned char bytes[Size];
+};
+
+// A dozen types of events, and their registry
+using events = type_pack<
+    event<1>, event<2>, event<3>, event<4>, event<5>, event<6>,
+    event<7>, event<8>, event<9>, event<10>, event<11>, event<12>
+>;
+using registry = type_registry<events>;
+
+// Number of stored events, and of runs of each benchmark
+inline constexpr std::size_t count = 1 << 20;
+inline constexpr std::size_t runs = 10;
+
+// Returns the positions in the pack of the types of random events
+std::vector<std::size_t> make_indices()
+{
+    std::vector<std::size_t> indices(count);
+    std::uint64_t state = 1;
+    for (std::size_t& index : indices) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        index = (state >> 32) % events::size();
+    }
+    return indices;
+}
+
+// Adds the size of the type of an event to a total
+template <class Type>
+void handle(std::uint64_t& total) noexcept
+{
+    total += sizeof(Type);
+}
+
+// The handlers of the events keyed by their std::type_index
+template <class... Types>
+std::unordered_map<std::type_index, void (*)(std::uint64_t&)> make_handlers(
+    type_pack<Types...>
+)
+{
+    return {{std::type_index(typeid(Types)), &handle<Types>}...};
+}
+
+// Returns the time to dispatch the events on their registry identifier
+double dispatch(const std::vector<std::size_t>& indices)
+{
+    std::vector<registry::id_type> ids(indices.begin(), indices.end());
+    return measure(runs, [&ids] {
+        std::uint64_t total = 0;
+        for (registry::id_type id : ids) {
+            registry::visit(id, [&total](auto type) {
+                handle<typename decltype(type)::type>(total);
+            });
+        }
+        keep(total);
+    });
+}
+
+// Returns the time to dispatch the events on their std::type_index
+template <class... Types>
+double dispatch_map(
+    const std::vector<std::size_t>& indices,
+    type_pack<Types...>
+)
+{
+    const std::type_index types[] = {std::type_index(typeid(Types))...};
+    const auto handlers = make_handlers(type_pack<Types...>{});
+    std::vector<std::type_index> ids;
+    for (std::size_t index : indices) {
+        ids.push_back(types[index]);
+    }
+    return measure(runs, [&ids, &handlers] {
+        std::uint64_t total = 0;
+        for (const std::type_index& id : ids) {
+            handlers.find(id)->second(total);
+        }
+        keep(total);
+    });
+}
+
+// Returns the time to count the events of each type in an array indexed by
+// their registry identifier
+double tally(const std::vector<std::size_t>& indices)
+{
+    std::vector<registry::id_type> ids(indices.begin(), indices.end());
+    return measure(runs, [&ids] {
+        std::size_t counts[registry::size()] = {};
+        for (registry::id_type id : ids) {
+            registry::visit(id, [&counts](auto type) {
+                ++counts[registry::id_of<typename decltype(type)::type>];
+            });
+        }
+        keep(counts);
+    });
+}
+
+// Returns the time to count the events of each type in an unordered map
+// keyed by their std::type_index
+double tally_map(const std::vector<std::size_t>& indices)
+{
+    std::vector<registry::id_type> ids(indices.begin(), indices.end());
+    return measure(runs, [&ids] {
+        std::unordered_map<std::type_index, std::size_t> counts;
+        for (registry::id_type id : ids) {
+            registry::visit(id, [&counts](auto type) {
+                using event_type = typename decltype(type)::type;
+                ++counts[std::type_index(typeid(event_type))];
+            });
+        }
+        keep(counts);
+    });
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- TYPE REGISTRY BENCHMARK: MAIN ---------------------- //
+// Runs the benchmarks
+int main(int, char*[])
+{
+    const std::vector<std::size_t> indices = make_indices();
+    section("dispatch of events of 12 types on their identifier, per event");
+    report("type_registry::visit", count, dispatch(indices));
+    report("unordered_map<type_index>", count, dispatch_map(indices, events{}));
+    section("count of events of each of 12 types, per event");
+    report("array indexed by id_of", count, tally(indices));
+    report("unordered_map<type_index>", count, tally_map(indices));
+    return 0;
+}
+// -------------------------------------------------------------------------- //
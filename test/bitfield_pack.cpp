@@ -0,0 +1,173 @@
+// =========================== BITFIELD PACK TEST =========================== //
+// Project:         Pack
+// Name:            bitfield_pack.cpp
+// Description:     Tests of the packs of fields of given numbers of bits
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ----------------------- BITFIELD PACK TEST: TYPES ------------------------ //
+// Fields fitting in a byte, in a 16-bit word, in a 64-bit word, and fields
+// crossing two 64-bit words
+using tiny = bitfield_pack<nontype_pack<3, 5>>;
+using small = bitfield_pack<nontype_pack<4, 12>>;
+using spread = bitfield_pack<nontype_pack<1, 9, 20, 17>>;
+using crossing = bitfield_pack<nontype_pack<40, 40, 7>>;
+
+// Sets the fields of a pack in a constant expression, and reads one back
+template <std::size_t Index>
+constexpr std::uint64_t set_and_get()
+{
+    crossing fields;
+    fields.set<0>(0xFFFFFFFFFFULL);
+    fields.set<1>(0x123456789AULL);
+    fields.set<2>(0x7F);
+    fields.set<0>(0);
+    return fields.get<Index>();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- BITFIELD PACK TEST: LAYOUT ----------------------- //
+// Stores the fields in the smallest words holding all of them
+void test_layout()
+{
+    static_assert(std::is_same_v<bitfield_value_t<1>, std::uint8_t>);
+    static_assert(std::is_same_v<bitfield_value_t<9>, std::uint16_t>);
+    static_assert(std::is_same_v<bitfield_value_t<20>, std::uint32_t>);
+    static_assert(std::is_same_v<bitfield_value_t<33>, std::uint64_t>);
+    static_assert(bitfield_mask(3) == 7 && bitfield_mask(64) == ~0ULL);
+    static_assert(sizeof(tiny) == 1 && tiny::words == 1 && tiny::bits == 8);
+    static_assert(sizeof(small) == 2 && small::size() == 2);
+    static_assert(sizeof(spread) == 8 && spread::words == 1);
+    static_assert(sizeof(crossing) == 16 && crossing::words == 2);
+    static_assert(std::is_same_v<spread::field_type<0>, std::uint8_t>);
+    static_assert(std::is_same_v<crossing::field_type<1>, std::uint64_t>);
+    static_assert(std::is_same_v<
+        small::value_type,
+        object_pack<std::uint8_t, std::uint16_t>
+    >);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- BITFIELD PACK TEST: ACCESS ----------------------- //
+// Reads and writes each field, truncated to its width, without touching the
+// others, including across words and in constant expressions
+void test_access()
+{
+    tiny x;
+    assert(x.get<0>() == 0 && x.get<1>() == 0);
+    x.set<0>(0xFF);
+    assert(x.get<0>() == 7 && x.get<1>() == 0);
+    x.set<1>(21);
+    x.set<0>(2);
+    assert(x.get<0>() == 2 && x.get<1>() == 21);
+    spread y;
+    y.set<2>(0xABCDE);
+    y.set<3>(0x1FFFF);
+    y.set<1>(0x1FF);
+    y.set<0>(1);
+    y.set<3>(0x10001);
+    assert(y.get<0>() == 1 && y.get<1>() == 0x1FF);
+    assert(y.get<2>() == 0xABCDE && y.get<3>() == 0x10001);
+    static_assert(set_and_get<0>() == 0);
+    static_assert(set_and_get<1>() == 0x123456789AULL);
+    static_assert(set_and_get<2>() == 0x7F);
+}
+
+// Reads and writes all the fields at once, truncated to their widths, with
+// or without the fields fitting in lanes of their own types within 64 bits
+void test_bulk()
+{
+    spread x(spread::value_type(3, 0x3FF, 0xFFFFF, 0x12345));
+    assert(x.get<0>() == 1 && x.get<1>() == 0x1FF);
+    assert(x.get<2>() == 0xFFFFF && x.get<3>() == 0x12345);
+    x.pack(spread::value_type(0, 0x101, 0x54321, 0));
+    const spread::value_type fields = x.unpack();
+    assert(get<0>(fields) == 0 && get<1>(fields) == 0x101);
+    assert(get<2>(fields) == 0x54321 && get<3>(fields) == 0);
+    const crossing y(crossing::value_type(~0ULL, 0xABCDEF0123ULL, 0xFF));
+    const crossing::value_type values = y.unpack();
+    assert(get<0>(values) == 0xFFFFFFFFFFULL);
+    assert(get<1>(values) == 0xABCDEF0123ULL && get<2>(values) == 0x7F);
+    using lanes = bitfield_pack<nontype_pack<5, 9, 18>>;
+    lanes z;
+    z.pack(lanes::value_type(0x21, 0x3FF, 0x4FFFF));
+    assert(z.get<0>() == 1 && z.get<1>() == 0x1FF && z.get<2>() == 0xFFFF);
+    const lanes::value_type unpacked = z.unpack();
+    assert(get<0>(unpacked) == 1 && get<1>(unpacked) == 0x1FF);
+    assert(get<2>(unpacked) == 0xFFFF);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- BITFIELD PACK TEST: VECTOR ----------------------- //
+// Stores the rows without padding, across the words of each column
+void test_vector()
+{
+    using rows = bitfield_vector<nontype_pack<3, 13, 64>>;
+    rows x;
+    assert(x.empty() && x.size() == 0);
+    x.reserve(100);
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        x.push_back(rows::value_type(i, i * 100, ~i));
+    }
+    assert(x.size() == 100);
+    for (std::size_t i = 0; i < 100; ++i) {
+        assert(x.get<0>(i) == i % 8 && x.get<1>(i) == i * 100 % 8192);
+        assert(x.get<2>(i) == ~std::uint64_t(i));
+    }
+    x.set<1>(4, 0xFFFF);
+    assert(x.get<1>(4) == 0x1FFF && x.get<1>(3) == 300 && x.get<1>(5) == 500);
+    x.store(9, rows::value_type(5, 1, 2));
+    const rows::value_type row = x.load(9);
+    assert(get<0>(row) == 5 && get<1>(row) == 1 && get<2>(row) == 2);
+    assert(x.get<0>(8) == 0 && x.get<0>(10) == 2);
+    x.resize(6);
+    x.resize(50);
+    assert(x.size() == 50 && x.get<1>(5) == 500);
+    for (std::size_t i = 6; i < 50; ++i) {
+        assert(x.get<0>(i) == 0 && x.get<1>(i) == 0 && x.get<2>(i) == 0);
+    }
+    x.clear();
+    assert(x.empty());
+    const rows y(3);
+    assert(y.size() == 3 && y.get<2>(2) == 0);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ BITFIELD PACK TEST: MAIN ------------------------ //
+// Runs the tests
+int main(int, char*[])
+{
+    test_layout();
+    test_access();
+    test_bulk();
+    test_vector();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
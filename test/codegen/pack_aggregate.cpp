@@ -0,0 +1,54 @@
+// ====================== PACK AGGREGATE CODEGEN TEST ======================= //
+// Project:         Pack
+// Name:            pack_aggregate.cpp
+// Description:     Accesses to the fields of an aggregate that should compile
+//                  to the same code through packs as by hand
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+// Project sources
+#include "../../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ------------------ PACK AGGREGATE CODEGEN TEST: ACCESS ------------------- //
+// A plain structure
+struct record
+{
+    int id;
+    double price;
+    long quantity;
+    float weight;
+};
+
+// Accesses the fields by hand
+extern "C" double hand_written(const record& value)
+{
+    return value.id + value.price * value.quantity + value.weight;
+}
+
+// Accesses the fields through a decomposition of the aggregate
+extern "C" double decomposed(const record& value)
+{
+    return pck::apply([](auto id, auto price, auto quantity, auto weight) {
+        return id + price * quantity + weight;
+    }, value);
+}
+
+// Accesses the fields through a reference pack view of the aggregate
+extern "C" double viewed(const record& value)
+{
+    const auto fields = pck::as_reference_pack(value);
+    return pck::get<0>(fields) + pck::get<1>(fields) * pck::get<2>(fields)
+         + pck::get<3>(fields);
+}
+// -------------------------------------------------------------------------- //
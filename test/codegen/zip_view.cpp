@@ -0,0 +1,36 @@
+// ========================= ZIP VIEW CODEGEN TEST ========================== //
+// Project:         Pack
+// Name:            zip_view.cpp
+// Description:     Loop over zipped contiguous ranges that should vectorize
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <vector>
+// Project sources
+#include "../../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ---------------------- ZIP VIEW CODEGEN TEST: LOOPS ---------------------- //
+// Fused multiply-add across three arrays, compiled with the vectorizer report
+void fused_multiply_add(
+    std::vector<double>& x,
+    const std::vector<double>& y,
+    const std::vector<double>& z
+)
+{
+    pck::zip(x, y, z).for_each([](auto row) {
+        pck::get<0>(row) = pck::get<0>(row) * pck::get<1>(row)
+                         + pck::get<2>(row);
+    });
+}
+// -------------------------------------------------------------------------- //
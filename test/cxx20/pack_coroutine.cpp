@@ -0,0 +1,183 @@
+// =========================== PACK COROUTINE TEST ========================== //
+// Project:         Pack
+// Name:            pack_coroutine.cpp
+// Description:     Tests of the coroutine tasks awaited together
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <string>
+#include <thread>
+#include <cassert>
+#include <cstddef>
+#include <variant>
+#include <stdexcept>
+#include <type_traits>
+// Project sources
+#include "../../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+#if !defined(PCK_HAS_COROUTINES)
+#error "the coroutine tests should be compiled with coroutines"
+#endif
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ----------------------- PACK COROUTINE TEST: TASKS ----------------------- //
+// Tasks producing values, nothing, or exceptions
+task<int> twice(int x)
+{
+    co_return 2 * x;
+}
+task<std::string> text(int x)
+{
+    co_return std::to_string(x);
+}
+inline int effects = 0;
+task<> effect()
+{
+    ++effects;
+    co_return;
+}
+task<int> failure()
+{
+    throw std::runtime_error("failure");
+    co_return 0;
+}
+
+// Tasks resuming on an event loop
+task<int> scheduled(event_loop& loop, int x)
+{
+    co_await loop.schedule();
+    co_return x + 1;
+}
+task<int> fan(event_loop& loop)
+{
+    auto [x, y, z] = co_await when_all(
+        scheduled(loop, 1),
+        scheduled(loop, 2),
+        twice(3)
+    );
+    co_return x + y + z;
+}
+
+// Tasks creating their children once resumed, in an arena or on the heap
+task<int> arena_fan(task_arena_base& arena, std::size_t& used)
+{
+    auto results = co_await when_all(
+        arena,
+        [] {return twice(1);},
+        [] {return twice(2);},
+        [] {return twice(3);}
+    );
+    used = arena.used();
+    co_return get<0>(results) + get<1>(results) + get<2>(results);
+}
+task<int> heap_fan(std::size_t& sum)
+{
+    auto results = co_await when_all(twice(1), twice(2), twice(3));
+    sum = get<0>(results) + get<1>(results) + get<2>(results);
+    co_return sum;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- PACK COROUTINE TEST: WHEN ALL ---------------------- //
+// Collects the results of the tasks in order, empty values for void tasks
+void test_when_all()
+{
+    event_loop loop;
+    auto all = [] () -> task<object_pack<int, std::string, std::monostate>> {
+        co_return co_await when_all(twice(4), text(5), effect());
+    };
+    effects = 0;
+    const auto results = loop.run(all());
+    static_assert(std::is_same_v<
+        std::decay_t<decltype(results)>,
+        object_pack<int, std::string, std::monostate>
+    >);
+    assert(get<0>(results) == 8 && get<1>(results) == "5" && effects == 1);
+}
+
+// Rethrows the exception of a failed task once all the tasks are done
+void test_exceptions()
+{
+    event_loop loop;
+    auto all = [] () -> task<int> {
+        auto [x, y] = co_await when_all(failure(), twice(1));
+        co_return x + y;
+    };
+    bool thrown = false;
+    try {
+        loop.run(all());
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- PACK COROUTINE TEST: EVENT LOOP --------------------- //
+// Resumes the scheduled coroutines on the loop, even when posted elsewhere
+void test_event_loop()
+{
+    event_loop loop;
+    assert(loop.run(fan(loop)) == 2 + 3 + 6);
+    assert(loop.run() == 0 && !loop.run_one());
+    task<int> work = scheduled(loop, 41);
+    work.handle().promise().continue_with(std::noop_coroutine());
+    std::thread poster([&loop, &work] {loop.post(work.handle());});
+    poster.join();
+    assert(loop.run() == 2 && work.done());
+    assert(work.handle().promise().result() == 42);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK COROUTINE TEST: ARENA ----------------------- //
+// Allocates in an arena the frames of the tasks created in it, and the ones
+// of the tasks created by a resumed coroutine through the arena form only
+void test_arena()
+{
+    event_loop loop;
+    task_arena<4096> arena;
+    std::size_t used = 0;
+    auto parent = arena.invoke([&] {return arena_fan(arena, used);});
+    const std::size_t frame = arena.used();
+    assert(frame > 0 && loop.run(std::move(parent)) == 12);
+    assert(used > frame && used <= arena.capacity());
+    std::size_t sum = 0;
+    auto heap = arena.invoke([&sum] {return heap_fan(sum);});
+    const std::size_t parent_only = arena.used();
+    assert(loop.run(std::move(heap)) == 12 && sum == 12);
+    assert(arena.used() == parent_only);
+    task_arena<64> small;
+    auto overflow = small.invoke([] {return twice(21);});
+    assert(small.used() == 0 && loop.run(std::move(overflow)) == 42);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK COROUTINE TEST: MAIN ------------------------ //
+// Runs the tests
+int main(int, char*[])
+{
+    test_when_all();
+    test_exceptions();
+    test_event_loop();
+    test_arena();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,198 @@
+// =========================== MESSAGE QUEUE TEST =========================== //
+// Project:         Pack
+// Name:            message_queue.cpp
+// Description:     Tests of the lock-free queue of messages of a type pack
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ----------------------- MESSAGE QUEUE TEST: TYPES ------------------------ //
+// Counts its live instances
+struct counted
+{
+    explicit counted(int value): value(value) {++instances;}
+    counted(const counted& other): value(other.value) {++instances;}
+    counted(counted&& other) noexcept: value(other.value) {++instances;}
+    ~counted() {--instances;}
+    int value;
+    inline static int instances = 0;
+};
+
+// A message identifying its producer
+struct tagged
+{
+    std::size_t producer;
+    std::size_t sequence;
+};
+
+// Calls the function object matching the message type
+template <class... Functions>
+struct overloaded
+: Functions...
+{
+    using Functions::operator()...;
+};
+template <class... Functions>
+overloaded(Functions...) -> overloaded<Functions...>;
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- MESSAGE QUEUE TEST: ORDER ------------------------ //
+// Hands messages of different types to the visitor in order, and refuses
+// messages once full
+void test_order()
+{
+    using queue_type = message_queue<type_pack<int, std::string, double>, 4>;
+    static_assert(std::is_same_v<queue_type::index_type, std::uint8_t>);
+    static_assert(queue_type::capacity() == 4);
+    queue_type queue;
+    std::string text;
+    int integers = 0;
+    double real = 0.;
+    const auto visitor = overloaded{
+        [&integers](int x) {integers = integers * 10 + x;},
+        [&text](std::string&& x) {text += x;},
+        [&real](double x) {real += x;}
+    };
+    assert(queue.try_push(1) && queue.try_emplace<std::string>(3, 'a'));
+    assert(queue.try_push(2.5) && queue.try_push(std::string("b")));
+    assert(!queue.try_push(2) && !queue.try_emplace<double>(1.));
+    assert(queue.try_pop(visitor) && integers == 1);
+    assert(queue.try_pop_n(visitor, 8) == 3);
+    assert(text == "aaab" && real == 2.5 && !queue.try_pop(visitor));
+    const std::vector<int> values = {2, 3, 4, 5, 6};
+    const auto rest = queue.try_push_n(values.begin(), values.end());
+    assert(rest == values.begin() + 4);
+    assert(queue.try_pop_n(visitor, 2) == 2 && integers == 123);
+    assert(queue.try_push_n(rest, values.end()) == values.end());
+    assert(queue.try_pop_n(visitor, 8) == 3 && integers == 123456);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- MESSAGE QUEUE TEST: LIFETIME ---------------------- //
+// Destroys the messages claimed along with one whose visitor throws, and the
+// ones left in the queue when it is destroyed
+void test_lifetime()
+{
+    {
+        message_queue<type_pack<int, counted>, 8> queue;
+        for (int i = 0; i < 6; ++i) {
+            queue.try_emplace<counted>(i + 1);
+        }
+        assert(counted::instances == 6);
+        int sum = 0;
+        bool thrown = false;
+        try {
+            queue.try_pop_n([&sum](auto&& message) {
+                if constexpr (std::is_same_v<decltype(message), counted&&>) {
+                    if (message.value == 2) {
+                        throw std::runtime_error("message");
+                    }
+                    sum += message.value;
+                }
+            }, 3);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && sum == 1 && counted::instances == 3);
+        queue.try_push(7);
+    }
+    assert(counted::instances == 0);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- MESSAGE QUEUE TEST: CONCURRENCY --------------------- //
+// Delivers every message exactly once with several producers and consumers,
+// in the order each producer pushed them when there is a single consumer
+void test_concurrency()
+{
+    constexpr std::size_t producers = 4;
+    constexpr std::size_t messages = 5000;
+    for (std::size_t consumers : {1, 3}) {
+        message_queue<type_pack<tagged, int>, 64> queue;
+        std::vector<std::atomic<std::size_t>> received(producers);
+        std::vector<std::size_t> last(producers, 0);
+        std::atomic<std::size_t> total = 0;
+        std::atomic<bool> ordered = true;
+        std::vector<std::thread> threads;
+        for (std::size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue, p] {
+                for (std::size_t i = 1; i <= messages; ) {
+                    if (queue.try_push(tagged{p, i})) {
+                        ++i;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (std::size_t c = 0; c < consumers; ++c) {
+            threads.emplace_back([&, consumers] {
+                const auto visitor = [&](tagged message) {
+                    if (consumers == 1) {
+                        const std::size_t previous = last[message.producer];
+                        ordered = ordered && previous + 1 == message.sequence;
+                        last[message.producer] = message.sequence;
+                    }
+                    ++received[message.producer];
+                    ++total;
+                };
+                const auto ignore = [](int) {};
+                while (total.load() < producers * messages) {
+                    if (queue.try_pop_n(overloaded{visitor, ignore}, 16) == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        assert(ordered.load() && total.load() == producers * messages);
+        for (std::size_t p = 0; p < producers; ++p) {
+            assert(received[p].load() == messages);
+        }
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ MESSAGE QUEUE TEST: MAIN ------------------------ //
+// Runs the tests
+int main(int, char*[])
+{
+    test_order();
+    test_lifetime();
+    test_concurrency();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
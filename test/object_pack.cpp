@@ -0,0 +1,280 @@
+// ============================ OBJECT PACK TEST ============================ //
+// Project:         Pack
+// Name:            object_pack.cpp
+// Description:     Tests of the object pack
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <tuple>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <memory_resource>
+#include <cassert>
+#include <utility>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ------------------------ OBJECT PACK TEST: TYPES ------------------------- //
+// Counts its moves, and opts in trivial relocation
+struct relocatable
+{
+    explicit relocatable(int value = 0): value(value) {}
+    relocatable(const relocatable& other): value(other.value) {++moves;}
+    relocatable(relocatable&& other): value(other.value) {++moves;}
+    relocatable& operator=(const relocatable& other) {
+        value = other.value;
+        ++moves;
+        return *this;
+    }
+    relocatable& operator=(relocatable&& other) {
+        value = other.value;
+        ++moves;
+        return *this;
+    }
+    int value;
+    inline static int moves = 0;
+};
+
+// Is trivially relocatable specialization: relocatable
+namespace pck {
+template <>
+struct is_trivially_relocatable<relocatable>
+: std::true_type
+{
+};
+} // namespace pck
+
+// A tuple, taking its allocator through a leading argument
+using leading = std::tuple<std::pmr::string>;
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- OBJECT PACK TEST: CONSTRUCTION --------------------- //
+// Constructs packs of references, which bind to the arguments
+void test_reference_construction()
+{
+    int a = 1;
+    const int b = 2;
+    object_pack<int&, const int&> pack(a, b);
+    assert(&pack[pack_index_v<0>].value() == &a);
+    assert(&pack[pack_index_v<1>].value() == &b);
+    static_assert(!std::is_constructible_v<object_pack<int&>, int>);
+    static_assert(!std::is_constructible_v<object_pack<int&>, const int&>);
+}
+
+// Constructs packs by forwarding each argument with its own category
+void test_forwarding_construction()
+{
+    std::string string = "string";
+    object_pack<std::unique_ptr<int>, std::string> pack(
+        std::make_unique<int>(1),
+        string
+    );
+    assert(*pack[pack_index_v<0>].value() == 1);
+    assert(string == "string");
+    object_pack<std::string> converted("converted");
+    object_pack<std::string> copied(converted);
+    object_pack<std::string> moved(std::move(copied));
+    assert(moved[pack_index_v<0>].value() == "converted");
+    static_assert(std::is_nothrow_constructible_v<
+        object_pack<int, double>,
+        int,
+        double
+    >);
+    static_assert(!std::is_constructible_v<object_pack<int, double>, int>);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- OBJECT PACK TEST: CONCATENATION --------------------- //
+// Concatenates packs of mixed categories, moving from the rvalue ones only
+void test_concatenation()
+{
+    object_pack<std::unique_ptr<int>> unique(std::make_unique<int>(1));
+    object_pack<int> copied(2);
+    auto pack = cat(std::move(unique), copied);
+    assert(*pack[pack_index_v<0>].value() == 1);
+    assert(pack[pack_index_v<1>].value() == 2);
+    assert(!unique[pack_index_v<0>].value());
+    assert(copied[pack_index_v<0>].value() == 2);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- OBJECT PACK TEST: TRIVIALITY ---------------------- //
+// Checks that triviality and noexcept propagate from the element types
+void test_triviality()
+{
+    using trivial = object_pack<int, double>;
+    using nontrivial = object_pack<int, std::string>;
+    static_assert(std::is_trivially_default_constructible_v<trivial>);
+    static_assert(std::is_trivially_copyable_v<trivial>);
+    static_assert(std::is_trivially_destructible_v<trivial>);
+    static_assert(std::is_nothrow_constructible_v<trivial, int, double>);
+    static_assert(!std::is_trivially_copyable_v<nontrivial>);
+    static_assert(std::is_nothrow_default_constructible_v<nontrivial>);
+    static_assert(std::is_nothrow_move_constructible_v<nontrivial>);
+    static_assert(std::is_nothrow_move_assignable_v<nontrivial>);
+    static_assert(!std::is_nothrow_copy_constructible_v<nontrivial>);
+    static_assert(is_trivially_relocatable_v<trivial>);
+    static_assert(!is_trivially_relocatable_v<nontrivial>);
+    static_assert(is_trivially_relocatable_v<object_pack<relocatable, int>>);
+    constexpr trivial pack(1, 2.);
+    static_assert(pack[pack_index_v<0>].value() == 1);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- OBJECT PACK TEST: UNINITIALIZED --------------------- //
+// Default initializes the elements of packs and of arrays of packs, running
+// the default constructors of the elements that have one
+void test_uninitialized()
+{
+    using trivial = object_pack<int, double>;
+    using nontrivial = object_pack<int, std::string>;
+    static_assert(std::is_nothrow_constructible_v<trivial, uninitialized_t>);
+    static_assert(!std::is_convertible_v<uninitialized_t, trivial>);
+    nontrivial pack(uninitialized);
+    assert(pack[pack_index_v<1>].value().empty());
+    pack[pack_index_v<0>].value() = 1;
+    assert(pack[pack_index_v<0>].value() == 1);
+    std::unique_ptr<nontrivial[]> array = make_uninitialized_array<
+        nontrivial
+    >(16);
+    for (int i = 0; i < 16; ++i) {
+        assert(array[i][pack_index_v<1>].value().empty());
+        array[i] = nontrivial(i, std::to_string(i));
+    }
+    assert(array[15][pack_index_v<1>].value() == "15");
+    auto values = make_uninitialized_array<trivial>(16);
+    values[0] = trivial(2, 3.);
+    assert(values[0][pack_index_v<1>].value() == 3.);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- OBJECT PACK TEST: ALLOCATORS ---------------------- //
+// Hands the allocator to the elements that use one, through a leading or a
+// trailing argument, and lets containers propagate their memory resources
+void test_allocators()
+{
+    using pack_type = object_pack<int, std::pmr::string, leading>;
+    using allocator_type = std::pmr::polymorphic_allocator<pack_type>;
+    static_assert(std::uses_allocator_v<pack_type, allocator_type>);
+    std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource resource(
+        buffer.data(),
+        buffer.size(),
+        std::pmr::null_memory_resource()
+    );
+    const allocator_type allocator(&resource);
+    const std::pmr::string text("a string too long to fit in the object");
+    pack_type pack(std::allocator_arg, allocator, 1, text, leading());
+    assert(pack[pack_index_v<1>].value() == text);
+    assert(pack[pack_index_v<1>].value().get_allocator() == allocator);
+    const leading& tuple = pack[pack_index_v<2>].value();
+    assert(std::get<0>(tuple).get_allocator() == allocator);
+    pack_type copy(std::allocator_arg, allocator_type(), pack);
+    assert(copy[pack_index_v<1>].value().get_allocator() != allocator);
+    pack_type moved(std::allocator_arg, allocator, std::move(copy));
+    assert(moved[pack_index_v<1>].value().get_allocator() == allocator);
+    std::pmr::vector<pack_type> packs(&resource);
+    packs.emplace_back(2, text, leading());
+    packs.emplace_back();
+    packs.push_back(pack);
+    for (const pack_type& element : packs) {
+        assert(element[pack_index_v<1>].value().get_allocator() == allocator);
+    }
+    assert(packs[0][pack_index_v<1>].value() == text);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- OBJECT PACK TEST: RELOCATION ---------------------- //
+// Sorts ranges whose trivially relocatable elements are swapped as bytes
+void test_relocation()
+{
+    std::vector<int> keys = {3, 1, 2};
+    std::vector<relocatable> values;
+    values.emplace_back(30);
+    values.emplace_back(10);
+    values.emplace_back(20);
+    relocatable::moves = 0;
+    sort_zip(keys, values);
+    assert(relocatable::moves == 0);
+    assert(values[0].value == 10);
+    assert(values[1].value == 20);
+    assert(values[2].value == 30);
+    object_pack<std::string> lhs("lhs");
+    object_pack<std::string> rhs("rhs");
+    relocating_swap(lhs, rhs);
+    assert(lhs[pack_index_v<0>].value() == "rhs");
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- OBJECT PACK TEST: KEYS ------------------------- //
+// Finds elements from keys of their exact types, cv-qualified or not, and from
+// keys converting to a single element type
+void test_keys()
+{
+    const int fixed = 1;
+    int value = 2;
+    short small = 3;
+    static_assert(decltype(type_pack<const int, double>{}[fixed])::index == 0);
+    static_assert(decltype(type_pack<int&, const int>{}[value])::index == 0);
+    static_assert(decltype(type_pack<long, std::string>{}["key"])::index == 1);
+    object_pack<const int, double, std::string> pack(4, 5., "six");
+    assert(pack[fixed].value() == 4 && pack[small].value() == 4);
+    assert(pack[1.f].value() == 5. && pack["key"].value() == "six");
+    pack[2.].value() = 7.;
+    const auto& immutable = pack;
+    assert(immutable[0.].value() == 7.);
+    double real = 8.;
+    reference_pack<const int&, double&> references(fixed, real);
+    assert(references[value].value() == 1 && references[small].value() == 1);
+    references[real].value() = 9.;
+    assert(real == 9.);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- OBJECT PACK TEST: MAIN ------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_triviality();
+    test_uninitialized();
+    test_allocators();
+    test_reference_construction();
+    test_forwarding_construction();
+    test_concatenation();
+    test_relocation();
+    test_keys();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
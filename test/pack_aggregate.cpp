@@ -0,0 +1,117 @@
+// ========================== PACK AGGREGATE TEST =========================== //
+// Project:         Pack
+// Name:            pack_aggregate.cpp
+// Description:     Tests of the views and conversions of aggregates
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <memory>
+#include <cassert>
+#include <utility>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ----------------------- PACK AGGREGATE TEST: TYPES ----------------------- //
+// An aggregate owning an object and referring to another
+struct owner
+{
+    std::unique_ptr<int> pointer;
+    int& reference;
+};
+
+// An aggregate of the largest supported size
+struct large
+{
+    int f00, f01, f02, f03, f04, f05, f06, f07;
+    int f08, f09, f10, f11, f12, f13, f14, f15;
+    int f16, f17, f18, f19, f20, f21, f22, f23;
+    int f24, f25, f26, f27, f28, f29, f30, f31;
+    int f32, f33, f34, f35, f36, f37, f38, f39;
+    int f40, f41, f42, f43, f44, f45, f46, f47;
+    int f48, f49, f50, f51, f52, f53, f54, f55;
+    int f56, f57, f58, f59, f60, f61, f62, f63;
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK AGGREGATE TEST: VIEWS ----------------------- //
+// Views the fields of lvalue and rvalue aggregates
+void test_views()
+{
+    int value = 1;
+    owner lvalue{std::make_unique<int>(2), value};
+    auto view = as_reference_pack(lvalue);
+    static_assert(std::is_same_v<
+        decltype(view),
+        reference_pack<std::unique_ptr<int>&, int&>
+    >);
+    get<1>(view) = 3;
+    assert(value == 3 && &get<0>(view) == &lvalue.pointer);
+    auto rvalue = as_reference_pack(owner{std::make_unique<int>(4), value});
+    static_assert(std::is_same_v<
+        decltype(rvalue),
+        reference_pack<std::unique_ptr<int>&&, int&>
+    >);
+    get<1>(rvalue) = 5;
+    assert(value == 5 && *get<0>(rvalue) == 4);
+    large fields{};
+    auto all = as_reference_pack(fields);
+    static_assert(decltype(all)::size() == aggregate_size_limit);
+    get<63>(all) = 6;
+    assert(fields.f63 == 6 && &get<0>(all) == &fields.f00);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- PACK AGGREGATE TEST: CONVERSIONS -------------------- //
+// Moves the objects of rvalue aggregates, and copies what their references
+void test_conversions()
+{
+    int value = 1;
+    owner source{std::make_unique<int>(2), value};
+    auto copy = to_object_pack(std::move(source));
+    static_assert(std::is_same_v<
+        decltype(copy),
+        object_pack<std::unique_ptr<int>, int>
+    >);
+    assert(!source.pointer && *get<0>(copy) == 2 && get<1>(copy) == 1);
+    get<1>(copy) = 3;
+    assert(value == 1);
+    large fields{};
+    fields.f63 = 4;
+    const auto all = to_object_pack(fields);
+    assert(get<63>(all) == 4 && get<0>(all) == 0);
+    const int sum = aggregate_apply([](std::unique_ptr<int>&& p, int& n) {
+        const std::unique_ptr<int> owned = std::move(p);
+        return *owned + ++n;
+    }, owner{std::make_unique<int>(5), value});
+    assert(sum == 7 && value == 2);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK AGGREGATE TEST: MAIN ------------------------ //
+// Runs the tests
+int main(int, char*[])
+{
+    test_views();
+    test_conversions();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,227 @@
+// ========================== PACK ALGORITHM TEST =========================== //
+// Project:         Pack
+// Name:            pack_algorithm.cpp
+// Description:     Parity tests of the value-based algorithms on type packs
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <string>
+#include <utility>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// --------------------- PACK ALGORITHM TEST: REFERENCE --------------------- //
+// Keeps the types satisfying a trait through template recursion
+template <template <class> class Trait, class Result, class... Types>
+struct recursive_filter
+{
+    using type = Result;
+};
+template <
+    template <class> class Trait,
+    class... Results,
+    class Type,
+    class... Types
+>
+struct recursive_filter<Trait, type_pack<Results...>, Type, Types...>
+: recursive_filter<
+    Trait,
+    std::conditional_t<
+        Trait<Type>::value,
+        type_pack<Results..., Type>,
+        type_pack<Results...>
+    >,
+    Types...
+>
+{
+};
+
+// Keeps the first occurrence of each type through template recursion
+template <class Result, class... Types>
+struct recursive_unique
+{
+    using type = Result;
+};
+template <class... Results, class Type, class... Types>
+struct recursive_unique<type_pack<Results...>, Type, Types...>
+: recursive_unique<
+    std::conditional_t<
+        std::disjunction_v<std::is_same<Type, Results>...>,
+        type_pack<Results...>,
+        type_pack<Results..., Type>
+    >,
+    Types...
+>
+{
+};
+
+// Finds the index of the first occurrence of a type through recursion
+template <class Key, class... Types>
+struct recursive_find
+: std::integral_constant<std::size_t, 0>
+{
+};
+template <class Key, class Type, class... Types>
+struct recursive_find<Key, Type, Types...>
+: std::integral_constant<
+    std::size_t,
+    std::is_same_v<Key, Type> ? 0 : 1 + recursive_find<Key, Types...>::value
+>
+{
+};
+
+// Counts the types satisfying a trait through template recursion
+template <template <class> class Trait, class... Types>
+struct recursive_count
+: std::integral_constant<std::size_t, 0>
+{
+};
+template <template <class> class Trait, class Type, class... Types>
+struct recursive_count<Trait, Type, Types...>
+: std::integral_constant<
+    std::size_t,
+    Trait<Type>::value + recursive_count<Trait, Types...>::value
+>
+{
+};
+
+// Represents an empty result as the empty pack, as the algorithms do
+template <class Pack>
+struct normalized
+{
+    using type = Pack;
+};
+template <>
+struct normalized<type_pack<>>
+{
+    using type = empty_pack;
+};
+template <class Pack>
+using normalized_t = typename normalized<Pack>::type;
+
+// Turns a trait into a predicate on type identifiers
+template <template <class> class Trait>
+inline constexpr auto predicate = [](auto id) {
+    return Trait<typename decltype(id)::type>::value;
+};
+
+// Turns a trait into a function on type identifiers
+template <template <class> class Trait>
+inline constexpr auto function = [](auto id) {
+    return type_id<typename Trait<typename decltype(id)::type>::type>{};
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- PACK ALGORITHM TEST: PARITY ----------------------- //
+// Checks that the value-based algorithms match the recursive ones on a pack
+template <
+    template <class> class Predicate,
+    template <class> class Function,
+    class... Types
+>
+constexpr bool check_parity(
+    type_pack<Types...> pack
+)
+{
+    using filtered = decltype(filter(pack, predicate<Predicate>));
+    using transformed = decltype(transform(pack, function<Function>));
+    using uniqued = decltype(unique(pack));
+    static_assert(std::is_same_v<
+        filtered,
+        normalized_t<
+            typename recursive_filter<Predicate, type_pack<>, Types...>::type
+        >
+    >);
+    static_assert(std::is_same_v<
+        transformed,
+        type_pack<typename Function<Types>::type...>
+    >);
+    static_assert(std::is_same_v<
+        uniqued,
+        normalized_t<typename recursive_unique<type_pack<>, Types...>::type>
+    >);
+    static_assert(pack_conjunction_v<(
+        find(pack, type_id_v<Types>) == recursive_find<Types, Types...>::value
+    )...>);
+    static_assert(find(pack, type_id_v<void>) == sizeof...(Types));
+    static_assert(
+        count_if(pack, predicate<Predicate>)
+        == recursive_count<Predicate, Types...>::value
+    );
+    static_assert(
+        find_if(pack, predicate<Predicate>)
+        == recursive_find<
+            std::true_type,
+            std::bool_constant<Predicate<Types>::value>...
+        >::value
+    );
+    return true;
+}
+
+// Is even trait definition
+template <class Type>
+struct is_even
+: std::bool_constant<Type::value % 2 == 0>
+{
+};
+
+// Makes a pack of repeating integral constants
+template <std::size_t... Indices>
+constexpr auto make_repeating_pack(
+    std::index_sequence<Indices...>
+) noexcept
+{
+    return type_pack<std::integral_constant<int, Indices % 5>...>{};
+}
+
+// Checks the parity on packs of various sizes and contents
+static_assert(check_parity<std::is_pointer, std::remove_pointer>(
+    type_pack<int*, float, int*, double*, char, std::string>{}
+));
+static_assert(check_parity<std::is_pointer, std::add_pointer>(
+    type_pack<int, float, char>{}
+));
+static_assert(check_parity<std::is_pointer, std::add_const>(
+    type_pack<int*>{}
+));
+static_assert(check_parity<is_even, std::add_const>(
+    make_repeating_pack(std::make_index_sequence<256>{})
+));
+static_assert(std::is_same_v<
+    decltype(unique(transform(
+        filter(pack<int*, float, int*, double*>(), predicate<std::is_pointer>),
+        function<std::remove_pointer>
+    ))),
+    pipe_t<
+        type_pack<int*, float, int*, double*>,
+        pipe_filter<std::is_pointer>,
+        pipe_transform<std::remove_pointer>,
+        pipe_unique
+    >
+>);
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK ALGORITHM TEST: MAIN ------------------------ //
+// Runs the tests, which are all compile-time checks
+int main(int, char*[])
+{
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,111 @@
+// ============================ PACK BATCH TEST ============================= //
+// Project:         Pack
+// Name:            pack_batch.cpp
+// Description:     Tests of the batches of records
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <vector>
+#include <cassert>
+#include <cstddef>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ------------------------- PACK BATCH TEST: TYPES ------------------------- //
+// Adds the second column to the first one, counting the blocks and the rows
+struct accumulate
+{
+    template <std::size_t Size>
+    void operator()(batch<Size, float, float>& block) const {
+        for (std::size_t i = 0; i < Size; ++i) {
+            get<0>(block)[i] += get<1>(block)[i];
+        }
+        ++blocks;
+    }
+    template <class Row>
+    void operator()(Row&& row) const {
+        get<0>(row) += get<1>(row);
+        ++rows;
+    }
+    int& blocks;
+    int& rows;
+};
+
+// Sums the first column, counting the blocks and the rows
+struct sum
+{
+    template <std::size_t Size>
+    void operator()(const batch<Size, float, float>& block) const {
+        for (float value : get<0>(block)) {
+            total += value;
+        }
+        ++blocks;
+    }
+    template <class Row>
+    void operator()(const Row& row) const {
+        total += get<0>(row);
+        ++rows;
+    }
+    float& total;
+    int& blocks;
+    int& rows;
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK BATCH TEST: WRITEBACK ----------------------- //
+// Writes the blocks back into the writable columns only
+void test_writeback()
+{
+    std::vector<float> sums(10, 1.f);
+    const std::vector<float> terms(10, 2.f);
+    int blocks = 0;
+    int rows = 0;
+    for_each_batch<4>(zip(sums, terms), accumulate{blocks, rows});
+    assert(blocks == 2 && rows == 2);
+    for (std::size_t i = 0; i < sums.size(); ++i) {
+        assert(sums[i] == 3.f && terms[i] == 2.f);
+    }
+    std::vector<object_pack<float, float>> records(
+        9,
+        object_pack<float, float>(1.f, 2.f)
+    );
+    blocks = 0;
+    rows = 0;
+    for_each_batch<4>(records, accumulate{blocks, rows});
+    assert(blocks == 2 && rows == 1);
+    for (const object_pack<float, float>& record : records) {
+        assert(get<0>(record) == 3.f && get<1>(record) == 2.f);
+    }
+    const std::vector<object_pack<float, float>>& immutable = records;
+    float total = 0.f;
+    blocks = 0;
+    rows = 0;
+    for_each_batch<4>(immutable, sum{total, blocks, rows});
+    assert(total == 27.f && blocks == 2 && rows == 1);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- PACK BATCH TEST: MAIN -------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_writeback();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,152 @@
+// ============================= PACK CAT TEST ============================== //
+// Project:         Pack
+// Name:            pack_cat.cpp
+// Description:     Tests of the concatenation and flattening of packs
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <string>
+#include <vector>
+#include <utility>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// -------------------------- PACK CAT TEST: TYPES -------------------------- //
+// Templates of each kind of template pack
+template <class...>
+struct types;
+template <auto...>
+struct values;
+template <class, auto...>
+struct mixed;
+
+// A distinct type for each index
+template <std::size_t>
+struct field
+{
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- PACK CAT TEST: KINDS -------------------------- //
+// Concatenates packs of each kind into a pack of the same kind
+void test_kinds()
+{
+    static_assert(std::is_same_v<cat_t<>, empty_pack>);
+    static_assert(std::is_same_v<
+        cat_t<type_pack<int>, type_pack<float, char>>,
+        type_pack<int, float, char>
+    >);
+    static_assert(std::is_same_v<
+        cat_t<nontype_pack<1, 'a'>, nontype_pack<2L>, nontype_pack<3>>,
+        nontype_pack<1, 'a', 2L, 3>
+    >);
+    static_assert(std::is_same_v<
+        cat_t<type_template_pack<std::vector>, type_template_pack<types>>,
+        type_template_pack<std::vector, types>
+    >);
+    static_assert(std::is_same_v<
+        cat_t<nontype_template_pack<values>, nontype_template_pack<values>>,
+        nontype_template_pack<values, values>
+    >);
+    static_assert(std::is_same_v<
+        cat_t<mixed_template_pack<std::array>, mixed_template_pack<mixed>>,
+        mixed_template_pack<std::array, mixed>
+    >);
+    static_assert(std::is_same_v<
+        cat_t<object_pack<int>, object_pack<std::string, int>>,
+        object_pack<int, std::string, int>
+    >);
+    static_assert(std::is_same_v<
+        cat_t<reference_pack<int&>, reference_pack<const int&>>,
+        reference_pack<int&, const int&>
+    >);
+}
+
+// Skips the empty packs wherever they are
+void test_empty_packs()
+{
+    static_assert(std::is_same_v<cat_t<empty_pack>, empty_pack>);
+    static_assert(std::is_same_v<cat_t<empty_pack, empty_pack>, empty_pack>);
+    static_assert(std::is_same_v<
+        cat_t<empty_pack, type_pack<int>, empty_pack, type_pack<char>>,
+        type_pack<int, char>
+    >);
+    static_assert(std::is_same_v<
+        cat_t<nontype_pack<1>, empty_pack, empty_pack>,
+        nontype_pack<1>
+    >);
+}
+
+// Concatenates more packs than are joined at a time, in order
+template <std::size_t... Indices>
+void test_many_packs(std::index_sequence<Indices...>)
+{
+    static_assert(std::is_same_v<
+        cat_t<type_pack<field<Indices>>...>,
+        type_pack<field<Indices>...>
+    >);
+    static_assert(std::is_same_v<
+        cat_t<type_pack<field<Indices>>..., empty_pack, type_pack<int>>,
+        type_pack<field<Indices>..., int>
+    >);
+    static_assert(std::is_same_v<
+        cat_t<nontype_pack<Indices>...>,
+        nontype_pack<Indices...>
+    >);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- PACK CAT TEST: FLATTEN ------------------------- //
+// Splices the nested type packs, at any depth, into a single type pack
+void test_flatten()
+{
+    static_assert(std::is_same_v<
+        flatten_t<type_pack<int, type_pack<char, type_pack<float>>, double>>,
+        type_pack<int, char, float, double>
+    >);
+    static_assert(std::is_same_v<
+        flatten_t<type_pack<empty_pack, int, empty_pack>>,
+        type_pack<int>
+    >);
+    static_assert(std::is_same_v<
+        flatten_t<type_pack<type_pack<empty_pack>>>,
+        empty_pack
+    >);
+    static_assert(std::is_same_v<
+        flatten_t<nontype_pack<1, 2>>,
+        nontype_pack<1, 2>
+    >);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- PACK CAT TEST: MAIN --------------------------- //
+// Runs the tests, which are all compile-time checks
+int main(int, char*[])
+{
+    test_kinds();
+    test_empty_packs();
+    test_many_packs(std::make_index_sequence<30>{});
+    test_flatten();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,145 @@
+// ========================== PACK EXPRESSION TEST ========================== //
+// Project:         Pack
+// Name:            pack_expression.cpp
+// Description:     Tests of the elementwise expressions on homogeneous packs
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <string>
+#include <cassert>
+#include <utility>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ---------------------- PACK EXPRESSION TEST: TYPES ----------------------- //
+// Detects whether two operands can be added
+template <class Lhs, class Rhs, class = void>
+struct is_addable
+: std::false_type
+{
+};
+template <class Lhs, class Rhs>
+struct is_addable<
+    Lhs,
+    Rhs,
+    std::void_t<decltype(std::declval<Lhs>() + std::declval<Rhs>())>
+>
+: std::true_type
+{
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- PACK EXPRESSION TEST: OPERANDS --------------------- //
+// Builds expressions from homogeneous packs and scalars only
+void test_operands()
+{
+    using ints = object_pack<int, int>;
+    using mixed = object_pack<int, std::string>;
+    static_assert(is_homogeneous_pack_v<ints>);
+    static_assert(is_homogeneous_pack_v<reference_pack<int&, const int&>>);
+    static_assert(!is_homogeneous_pack_v<mixed>);
+    static_assert(is_addable<const ints&, int>::value);
+    static_assert(is_addable<double, ints>::value);
+    static_assert(!is_addable<mixed, mixed>::value);
+    static_assert(!is_addable<ints, std::string>::value);
+    static_assert(std::is_same_v<
+        decltype(std::declval<const ints&>() + 1),
+        pack_expression<std::plus<>, const ints&, int>
+    >);
+    static_assert(std::is_same_v<
+        decltype(ints(1, 2) + 1),
+        pack_expression<std::plus<>, ints, int>
+    >);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- PACK EXPRESSION TEST: EVALUATION --------------------- //
+// Evaluates the elements lazily, reading the lvalue packs when evaluated
+void test_evaluation()
+{
+    object_pack<int, int, int> x(1, 2, 3);
+    const object_pack<double, double, double> y(.5, .25, .125);
+    const auto expression = -(x + y * 2) / 2.;
+    static_assert(decltype(expression)::size() == 3);
+    static_assert(std::tuple_size_v<std::decay_t<decltype(expression)>> == 3);
+    assert(get<0>(expression) == -1. && expression[pack_index_v<2>] == -1.625);
+    get<0>(x) = 3;
+    assert(get<0>(expression) == -2.);
+    const auto values = evaluate(expression);
+    static_assert(std::is_same_v<
+        std::decay_t<decltype(values)>,
+        object_pack<double, double, double>
+    >);
+    assert(get<0>(values) == -2. && get<1>(values) == -1.25);
+    static constexpr object_pack<int, int> constant(1, 2);
+    static_assert(get<0>(constant * 2 - 1) == 1);
+    static_assert(get<1>(constant * 2 - 1) == 3);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- PACK EXPRESSION TEST: ASSIGNMENT --------------------- //
+// Assigns expressions to object packs and to the objects of reference packs
+void test_assignment()
+{
+    object_pack<long, long> x(1, 2);
+    const object_pack<int, int> y(3, 4);
+    x = y * 2 + x;
+    assert(get<0>(x) == 7 && get<1>(x) == 10);
+    int a = 1;
+    int b = 2;
+    reference_pack<int&, int&> references(a, b);
+    references = y - 1;
+    assert(a == 2 && b == 3);
+    references = references * references;
+    assert(a == 4 && b == 9);
+}
+
+// Computes every element before storing any, so that targets may alias
+// the operands in any order
+void test_aliasing()
+{
+    object_pack<int, int> x(1, 2);
+    reference_pack<int&, int&> swapped(get<1>(x), get<0>(x));
+    x = swapped + 0;
+    assert(get<0>(x) == 2 && get<1>(x) == 1);
+    int a = 1;
+    int b = 2;
+    reference_pack<int&, int&> forward(a, b);
+    reference_pack<int&, int&> backward(b, a);
+    forward = backward * 10;
+    assert(a == 20 && b == 10);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK EXPRESSION TEST: MAIN ----------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_operands();
+    test_evaluation();
+    test_assignment();
+    test_aliasing();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,151 @@
+// ============================= PACK PIPE TEST ============================= //
+// Project:         Pack
+// Name:            pack_pipe.cpp
+// Description:     Tests of the fused lazy pipelines of type pack steps
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <string>
+#include <utility>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ------------------------- PACK PIPE TEST: TYPES -------------------------- //
+// A transformation that does not compile for non-integral types
+template <class Type>
+struct make_wider
+{
+    static_assert(std::is_integral_v<Type>, "only integers are widened");
+    using type = long long;
+};
+
+// A transformation mapping every type to the same one
+template <class>
+struct to_int
+{
+    using type = int;
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- PACK PIPE TEST: STEPS -------------------------- //
+// Keeps the types satisfying the predicate, in order
+void test_filter()
+{
+    using pack_type = type_pack<int*, float, char*, double*, std::string>;
+    static_assert(std::is_same_v<
+        pipe_t<pack_type, pipe_filter<std::is_pointer>>,
+        type_pack<int*, char*, double*>
+    >);
+    static_assert(std::is_same_v<
+        pipe_t<type_pack<int, float>, pipe_filter<std::is_pointer>>,
+        empty_pack
+    >);
+}
+
+// Replaces each type by the type of the function
+void test_transform()
+{
+    static_assert(std::is_same_v<
+        pipe_t<type_pack<int*, const char*>, pipe_transform<std::add_const>>,
+        type_pack<int* const, const char* const>
+    >);
+    static_assert(std::is_same_v<
+        pipe_t<
+            type_pack<int**, float*>,
+            pipe_transform<std::remove_pointer>,
+            pipe_transform<std::remove_pointer>
+        >,
+        type_pack<int, float>
+    >);
+}
+
+// Keeps the first occurrence of each type, as it is at the unique step
+void test_unique()
+{
+    static_assert(std::is_same_v<
+        pipe_t<type_pack<int, float, int, char, float>, pipe_unique>,
+        type_pack<int, float, char>
+    >);
+    static_assert(std::is_same_v<
+        pipe_t<
+            type_pack<int*, float, int*, double*>,
+            pipe_unique,
+            pipe_transform<to_int>
+        >,
+        type_pack<int, int, int>
+    >);
+    static_assert(std::is_same_v<
+        pipe_t<
+            type_pack<int*, float, int*, double*>,
+            pipe_transform<to_int>,
+            pipe_unique
+        >,
+        type_pack<int>
+    >);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ PACK PIPE TEST: FUSION -------------------------- //
+// Chains the steps in order, without instantiating the steps that follow a
+// filter for the types it discards
+void test_fusion()
+{
+    static_assert(std::is_same_v<
+        pipe_t<
+            type_pack<char, std::string, short, double, char>,
+            pipe_filter<std::is_integral>,
+            pipe_transform<make_wider>,
+            pipe_unique
+        >,
+        type_pack<long long>
+    >);
+    static_assert(std::is_same_v<
+        pipe_t<
+            type_pack<int*, float, int*, double*>,
+            pipe_filter<std::is_pointer>,
+            pipe_transform<std::remove_pointer>,
+            pipe_unique
+        >,
+        type_pack<int, double>
+    >);
+    static_assert(std::is_same_v<
+        pipe_t<empty_pack, pipe_filter<std::is_pointer>, pipe_unique>,
+        empty_pack
+    >);
+    static_assert(std::is_same_v<
+        pipe_t<type_pack<int, float>>,
+        type_pack<int, float>
+    >);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- PACK PIPE TEST: MAIN --------------------------- //
+// Runs the tests, which are all compile-time checks
+int main(int, char*[])
+{
+    test_filter();
+    test_transform();
+    test_unique();
+    test_fusion();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
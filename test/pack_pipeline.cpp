@@ -0,0 +1,216 @@
+// =========================== PACK PIPELINE TEST =========================== //
+// Project:         Pack
+// Name:            pack_pipeline.cpp
+// Description:     Tests of the streaming of messages through threaded stages
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <numeric>
+#include <iterator>
+#include <stdexcept>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ----------------------- PACK PIPELINE TEST: TYPES ------------------------ //
+// Stages turning integers into other integers
+struct square {
+    using input_type = int;
+    using output_type = long;
+    long operator()(int x) const {return 1L * x * x;}
+};
+struct shift {
+    using input_type = long;
+    using output_type = long;
+    long operator()(long x) const {return x + 1;}
+};
+
+// A stage outputting nothing, adding its inputs to a total
+inline std::atomic<long> total = 0;
+struct accumulate {
+    using input_type = long;
+    using output_type = void;
+    void operator()(long x) const {total += x;}
+};
+
+// A stage throwing on a given input
+inline std::atomic<int> failing = -1;
+struct check {
+    using input_type = int;
+    using output_type = int;
+    int operator()(int x) const {
+        if (x == failing.load()) {
+            throw std::runtime_error("check");
+        }
+        return x;
+    }
+};
+
+// An output iterator throwing once a given number of outputs are written
+struct limited_output
+{
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+    limited_output& operator*() {return *this;}
+    limited_output& operator++() {return *this;}
+    limited_output& operator++(int) {return *this;}
+    limited_output& operator=(long) {
+        if ((*remaining)-- == 0) {
+            throw std::runtime_error("output");
+        }
+        return *this;
+    }
+    std::size_t* remaining;
+};
+
+// Returns the integers of [0, count)
+std::vector<int> iota(std::size_t count)
+{
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- PACK PIPELINE TEST: ORDERING ---------------------- //
+// Keeps the order of the inputs through replicated stages, for streams of
+// full blocks, of a partial last block, and shorter than a block
+void test_ordering()
+{
+    using stream = pipeline<
+        type_pack<replicated<square, 3>, shift, replicated<shift, 2>>,
+        4,
+        8
+    >;
+    static_assert(stream::size() == 3);
+    static_assert(stream::replicas(0) == 3 && stream::replicas(2) == 2);
+    stream stages;
+    for (std::size_t count : {0, 3, 4, 96, 1001}) {
+        const std::vector<int> inputs = iota(count);
+        std::vector<long> outputs;
+        stages.run(inputs.begin(), inputs.end(), std::back_inserter(outputs));
+        assert(outputs.size() == count);
+        for (std::size_t i = 0; i < count; ++i) {
+            assert(outputs[i] == static_cast<long>(i * i + 2));
+        }
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- PACK PIPELINE TEST: VOID OUTPUTS -------------------- //
+// Streams the inputs to a last stage that outputs nothing
+void test_void_outputs()
+{
+    using stream = pipeline<
+        type_pack<replicated<square, 2>, replicated<accumulate, 3>>,
+        4,
+        8
+    >;
+    stream stages;
+    for (std::size_t count : {0, 5, 64, 999}) {
+        const std::vector<int> inputs = iota(count);
+        total = 0;
+        stages.run(inputs.begin(), inputs.end());
+        long expected = 0;
+        for (long x : inputs) {
+            expected += x * x;
+        }
+        assert(total == expected);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- PACK PIPELINE TEST: EXCEPTIONS --------------------- //
+// Stops the stream and rethrows the first exception of a stage or of the
+// output, leaving the pipeline ready for another run
+void test_exceptions()
+{
+    using stream = pipeline<
+        type_pack<replicated<check, 3>, square, accumulate>,
+        4,
+        8
+    >;
+    using checked = pipeline<type_pack<check, square>, 4, 8>;
+    const std::vector<int> inputs = iota(1000);
+    stream stages;
+    checked outputs;
+    for (int value : {0, 5, 500, 999}) {
+        bool thrown = false;
+        failing = value;
+        try {
+            stages.run(inputs.begin(), inputs.end());
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        thrown = false;
+        try {
+            std::vector<long> results;
+            outputs.run(
+                inputs.begin(),
+                inputs.end(),
+                std::back_inserter(results)
+            );
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        std::size_t remaining = value;
+        thrown = false;
+        failing = -1;
+        try {
+            outputs.run(
+                inputs.begin(),
+                inputs.end(),
+                limited_output{&remaining}
+            );
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    total = 0;
+    stages.run(inputs.begin(), inputs.end());
+    assert(total == 332833500);
+    std::vector<long> results;
+    outputs.run(inputs.begin(), inputs.end(), std::back_inserter(results));
+    assert(results.size() == inputs.size() && results.back() == 998001);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ PACK PIPELINE TEST: MAIN ------------------------ //
+// Runs the tests
+int main(int, char*[])
+{
+    test_ordering();
+    test_void_outputs();
+    test_exceptions();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
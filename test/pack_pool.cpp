@@ -0,0 +1,206 @@
+// ============================= PACK POOL TEST ============================= //
+// Project:         Pack
+// Name:            pack_pool.cpp
+// Description:     Tests of the segregated free lists of the types of a pack
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <set>
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ------------------------- PACK POOL TEST: TYPES -------------------------- //
+// An over-aligned type
+struct alignas(64) wide
+{
+    char value;
+};
+
+// Counts its live instances, and throws when constructed from a negative
+struct counted
+{
+    explicit counted(int value): value(value) {
+        if (value < 0) {
+            throw std::invalid_argument("counted");
+        }
+        ++instances;
+    }
+    ~counted() {--instances;}
+    int value;
+    inline static int instances = 0;
+};
+
+// Returns whether a pointer is aligned on the given boundary
+bool is_aligned(const void* pointer, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- PACK POOL TEST: ALLOCATION ----------------------- //
+// Hands out distinct aligned blocks of each type, beyond the size of a slab,
+// and reuses the last block deallocated first
+void test_allocation()
+{
+    pack_pool<type_pack<char, double, wide>> pool;
+    std::set<const void*> blocks;
+    std::vector<char*> characters;
+    std::vector<wide*> wides;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        characters.push_back(pool.allocate<char>());
+        wides.push_back(pool.allocate<wide>());
+        assert(is_aligned(wides.back(), alignof(wide)));
+        blocks.insert(characters.back());
+        blocks.insert(wides.back());
+    }
+    assert(blocks.size() == 2000);
+    double* real = pool.allocate<double>();
+    assert(is_aligned(real, alignof(double)) && blocks.count(real) == 0);
+    pool.deallocate(real);
+    assert(pool.allocate<double>() == real);
+    pool.deallocate(wides[10]);
+    pool.deallocate(wides[20]);
+    assert(pool.allocate<wide>() == wides[20]);
+    assert(pool.allocate<wide>() == wides[10]);
+    for (std::size_t i = 0; i < 1000; ++i) {
+        pool.deallocate(characters[i]);
+        pool.deallocate(wides[i]);
+    }
+    pool.deallocate(real);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- PACK POOL TEST: CONSTRUCTION ---------------------- //
+// Constructs and destroys objects, returning the block of an object whose
+// constructor throws
+void test_construction()
+{
+    pack_pool<type_pack<int, counted>> pool;
+    counted* first = pool.create<counted>(1);
+    counted* second = pool.create<counted>(2);
+    assert(first != second && counted::instances == 2);
+    assert(first->value == 1 && second->value == 2);
+    pool.destroy(second);
+    assert(counted::instances == 1);
+    bool thrown = false;
+    try {
+        pool.create<counted>(-1);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown && counted::instances == 1);
+    assert(pool.create<counted>(3) == second);
+    pool.destroy(second);
+    pool.destroy(first);
+    assert(counted::instances == 0);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ PACK POOL TEST: THREADS ------------------------- //
+// Shares the blocks between threads deallocating the blocks of others, and
+// keeps the blocks cached by a thread valid after the pool is destroyed
+void test_threads()
+{
+    constexpr std::size_t threads = 4;
+    constexpr std::size_t count = 5000;
+    auto pool = std::make_unique<pack_pool<type_pack<int, long>>>();
+    std::vector<std::vector<long*>> blocks(threads);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&pool, &blocks, t] {
+            for (std::size_t i = 0; i < count; ++i) {
+                blocks[t].push_back(pool->create<long>(t * count + i));
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+    std::set<long*> unique;
+    for (std::size_t t = 0; t < threads; ++t) {
+        for (std::size_t i = 0; i < count; ++i) {
+            assert(*blocks[t][i] == static_cast<long>(t * count + i));
+            unique.insert(blocks[t][i]);
+        }
+    }
+    assert(unique.size() == threads * count);
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&pool, &blocks, t] {
+            for (long* block : blocks[(t + 1) % threads]) {
+                pool->destroy(block);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    int* cached = pool->create<int>(1);
+    pool->destroy(cached);
+    pool.reset();
+}
+
+// Keeps the blocks of more pools than the caches of a thread apart
+void test_pools()
+{
+    using pool_type = pack_pool<type_pack<int>>;
+    std::array<pool_type, 6> pools;
+    std::array<std::set<int*>, 6> blocks;
+    for (std::size_t round = 0; round < 3; ++round) {
+        for (std::size_t i = 0; i < pools.size(); ++i) {
+            for (std::size_t j = 0; j < 100; ++j) {
+                blocks[i].insert(pools[i].create<int>(0));
+            }
+        }
+    }
+    std::set<int*> unique;
+    for (std::size_t i = 0; i < pools.size(); ++i) {
+        assert(blocks[i].size() == 300);
+        unique.insert(blocks[i].begin(), blocks[i].end());
+        for (int* block : blocks[i]) {
+            pools[i].destroy(block);
+        }
+    }
+    assert(unique.size() == 1800);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- PACK POOL TEST: MAIN -------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_allocation();
+    test_construction();
+    test_threads();
+    test_pools();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
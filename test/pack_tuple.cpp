@@ -0,0 +1,211 @@
+// ============================ PACK TUPLE TEST ============================= //
+// Project:         Pack
+// Name:            pack_tuple.cpp
+// Description:     Tests of the tuple protocol and of the views of packs
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <tuple>
+#include <string>
+#include <cassert>
+#include <utility>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ------------------------- PACK TUPLE TEST: TYPES ------------------------- //
+// Counts the copies and moves of its instances
+struct counted
+{
+    counted() = default;
+    counted(const counted&) {++copies;}
+    counted(counted&&) {++moves;}
+    counted& operator=(const counted&) = default;
+    counted& operator=(counted&&) = default;
+    inline static int copies = 0;
+    inline static int moves = 0;
+};
+
+// Has no fields
+struct empty
+{
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- PACK TUPLE TEST: TUPLE PROTOCOL --------------------- //
+// Binds the elements of packs through the tuple protocol
+void test_tuple_protocol()
+{
+    object_pack<int, double> objects(1, 2.);
+    static_assert(std::tuple_size_v<decltype(objects)> == 2);
+    static_assert(std::is_same_v<
+        std::tuple_element_t<1, decltype(objects)>,
+        double
+    >);
+    auto& [i, d] = objects;
+    i = 3;
+    assert(get<0>(objects) == 3 && d == 2.);
+    static_assert(std::is_same_v<decltype(get<0>(std::move(objects))), int&&>);
+    int x = 4;
+    const double y = 5.;
+    reference_pack<int&, const double&> references(x, y);
+    static_assert(std::tuple_size_v<decltype(references)> == 2);
+    auto [rx, ry] = references;
+    rx = 6;
+    assert(x == 6 && &ry == &y);
+    static_assert(std::is_same_v<decltype(get<1>(references)), const double&>);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- PACK TUPLE TEST: APPLY ------------------------- //
+// Forwards the elements of packs with their categories, without temporaries:
+// the rvalue elements of a reference pack are moved in once, when it is built
+void test_apply()
+{
+    counted a;
+    counted b;
+    counted::copies = 0;
+    counted::moves = 0;
+    reference_pack<counted&&, counted&> references(std::move(a), b);
+    assert(counted::copies == 0 && counted::moves == 1);
+    pck::apply([&b](auto&& first, auto&& second) {
+        static_assert(std::is_same_v<decltype(first), counted&&>);
+        static_assert(std::is_same_v<decltype(second), counted&>);
+        assert(&second == &b);
+    }, std::move(references));
+    auto tuple = as_tuple_of_refs(std::move(references));
+    static_assert(std::is_same_v<
+        decltype(tuple),
+        std::tuple<counted&&, counted&>
+    >);
+    assert(&std::get<1>(tuple) == &b);
+    assert(counted::copies == 0 && counted::moves == 1);
+    object_pack<counted> objects;
+    pck::apply([&objects](auto&& object) {
+        static_assert(std::is_same_v<decltype(object), counted&&>);
+        assert(&object == &get<0>(objects));
+    }, std::move(objects));
+    assert(counted::copies == 0 && counted::moves == 1);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- PACK TUPLE TEST: VIEWS ------------------------- //
+// Views tuples as reference packs and packs as tuples of references
+void test_views()
+{
+    std::tuple<int, double> tuple(1, 2.);
+    auto references = as_reference_pack(tuple);
+    static_assert(std::is_same_v<
+        decltype(references),
+        reference_pack<int&, double&>
+    >);
+    assert(&get<0>(references) == &std::get<0>(tuple));
+    auto sliced = slice<1, 2>(tuple);
+    assert(&get<0>(sliced) == &std::get<1>(tuple));
+    auto gathered = gather(tuple, pack_index_sequence<1, 0>{});
+    assert(&get<1>(gathered) == &std::get<0>(tuple));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ PACK TUPLE TEST: BINDING ------------------------ //
+// Binds references to mutable or derived objects, but never to temporaries
+void test_binding()
+{
+    struct base {int value = 1;};
+    struct derived: base {};
+    int x = 1;
+    double d = 2.;
+    derived object;
+    reference_pack<const int&, double&> references(x, d);
+    assert(&get<0>(references) == &x && &get<1>(references) == &d);
+    reference_pack<const base&, base&> bases(object, object);
+    assert(&get<0>(bases) == &object && &get<1>(bases) == &object);
+    static_assert(std::is_constructible_v<reference_pack<const int&>, int>);
+    static_assert(!std::is_constructible_v<reference_pack<int&>, int>);
+    static_assert(!std::is_constructible_v<reference_pack<const int&>, long&>);
+    static_assert(!std::is_constructible_v<reference_pack<int&&>, int&>);
+    static_assert(!std::is_constructible_v<reference_pack<int&>, int&, int&>);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- PACK TUPLE TEST: CONCATENATION --------------------- //
+// Concatenates reference packs, moving the objects of the rvalue ones only
+void test_concatenation()
+{
+    int x = 1;
+    reference_pack<int&> lvalues(x);
+    reference_pack<std::string&&> rvalues(std::string("text"));
+    auto pack = cat(lvalues, std::move(rvalues));
+    static_assert(std::is_same_v<
+        decltype(pack),
+        reference_pack<int&, std::string&&>
+    >);
+    assert(&get<0>(pack) == &x && get<1>(pack) == "text");
+    auto again = cat(pack, lvalues);
+    static_assert(std::is_same_v<
+        decltype(again),
+        reference_pack<int&, std::string&&, int&>
+    >);
+    assert(&get<0>(again) == &x && &get<2>(again) == &x);
+    assert(get<1>(pack) == "text");
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- PACK TUPLE TEST: EMPTY VIEWS ---------------------- //
+// Views no element of tuples, packs and aggregates as empty reference packs
+void test_empty_views()
+{
+    std::tuple<int, double> tuple(1, 2.);
+    auto sliced = slice<1, 1>(tuple);
+    auto gathered = gather(tuple, pack_index_sequence<>{});
+    auto viewed = as_reference_pack(std::tuple<>{});
+    auto fields = as_reference_pack(empty{});
+    static_assert(std::is_same_v<decltype(sliced), reference_pack<>>);
+    static_assert(std::is_same_v<decltype(gathered), reference_pack<>>);
+    static_assert(std::is_same_v<decltype(viewed), reference_pack<>>);
+    static_assert(std::is_same_v<decltype(fields), reference_pack<>>);
+    static_assert(reference_pack<>::size() == 0);
+    reference_pack<> references;
+    static_cast<void>(references);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- PACK TUPLE TEST: MAIN -------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_tuple_protocol();
+    test_apply();
+    test_views();
+    test_binding();
+    test_concatenation();
+    test_empty_views();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,60 @@
+// ======================== PADDED OBJECT PACK TEST ========================= //
+// Project:         Pack
+// Name:            padded_object_pack.cpp
+// Description:     Tests of the padded object pack
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <memory>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ----------------- PADDED OBJECT PACK TEST: CONSTRUCTION ------------------ //
+// Constructs padded packs of references and of move-only objects
+void test_construction()
+{
+    int a = 1;
+    const int b = 2;
+    padded_object_pack<int&, const int&> references(a, b);
+    assert(&references[pack_index_v<0>].value() == &a);
+    assert(&references[pack_index_v<1>].value() == &b);
+    padded_object_pack<std::unique_ptr<int>, int> objects(
+        std::make_unique<int>(3),
+        4
+    );
+    assert(*objects[pack_index_v<0>].value() == 3);
+    const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(
+        &objects[pack_index_v<0>]
+    );
+    const std::uintptr_t second = reinterpret_cast<std::uintptr_t>(
+        &objects[pack_index_v<1>]
+    );
+    assert(second - first >= cache_line_size);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- PADDED OBJECT PACK TEST: MAIN ---------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_construction();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
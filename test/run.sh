@@ -0,0 +1,158 @@
+#!/bin/sh
+# ================================ TEST RUNNER =============================== #
+# Project:         Pack
+# Name:            run.sh
+# Description:     Compiles and runs each test of the directory
+# Creator:         Vincent Reverdy
+# Contributor(s):  Vincent Reverdy [2019]
+# License:         BSD 3-Clause License
+# ========================================================================== #
+set -e
+cd "$(dirname "$0")"
+CXX="${CXX:-g++}"
+CXXFLAGS="${CXXFLAGS:--std=c++17 -Wall -Wextra -O2 -pthread}"
+CXX20FLAGS="${CXX20FLAGS:--std=c++20 -Wall -Wextra -O2 -pthread}"
+LDLIBS="${LDLIBS:--latomic}"
+BUILD="${BUILD:-build}"
+STRESS="${STRESS:-}"
+BENCH="${BENCH:-}"
+STRESS_SIZE="${STRESS_SIZE:-16384}"
+STRESS_TIME="${STRESS_TIME:-600}"
+STRESS_MEMORY="${STRESS_MEMORY:-8388608}"
+mkdir -p "$BUILD"
+
+# Reports a failed test and stops
+fail() {
+    echo "[FAILED] $1"
+    exit 1
+}
+
+# Prints the time in milliseconds taken by a command
+elapsed() {
+    start="$(date +%s%N)"
+    "$@" || return 1
+    echo "$(( ($(date +%s%N) - start) / 1000000 ))"
+}
+
+# Prints the number of classes instantiated by the compilation of a file with
+# g++, including those of the headers
+classes() {
+    $CXX $CXXFLAGS -fsyntax-only -fdump-lang-class="$BUILD/bench/classes" \
+        "$@" || return 1
+    grep -c "^Class" "$BUILD/bench/classes"
+    rm -f "$BUILD/bench/classes"
+}
+
+# Prints the instructions of a function of an assembly file
+body() {
+    awk -v name="$2:" '
+        $0 == name {found = 1; next}
+        found && /\.cfi_endproc/ {exit}
+        found && !/^[[:space:]]*\.cfi/ && !/^\.L/
+    ' "$1"
+}
+
+# Compiles and runs each test, linked against libatomic for the atomic packs
+# of 9 to 16 bytes that cannot use cmpxchg16b
+for test in *.cpp; do
+    name="${test%.cpp}"
+    echo "[ RUN  ] $name"
+    $CXX $CXXFLAGS "$test" -o "$BUILD/$name" $LDLIBS || fail "$name"
+    "./$BUILD/$name" || fail "$name"
+    echo "[  OK  ] $name"
+done
+
+# Compiles and runs each test of the features requiring C++20
+for test in cxx20/*.cpp; do
+    name="${test%.cpp}"
+    echo "[ RUN  ] $name"
+    $CXX $CXX20FLAGS "$test" -o "$BUILD/${name#cxx20/}" $LDLIBS \
+        || fail "$name"
+    "./$BUILD/${name#cxx20/}" || fail "$name"
+    echo "[  OK  ] $name"
+done
+
+# Runs the atomic pack test again with cmpxchg16b on x86-64, without libatomic
+if [ "$(uname -m)" = "x86_64" ]; then
+    echo "[ RUN  ] atomic_pack (cmpxchg16b)"
+    $CXX $CXXFLAGS -mcx16 atomic_pack.cpp -o "$BUILD/atomic_pack_cx16" \
+        || fail "atomic_pack (cmpxchg16b)"
+    "./$BUILD/atomic_pack_cx16" || fail "atomic_pack (cmpxchg16b)"
+    echo "[  OK  ] atomic_pack (cmpxchg16b)"
+fi
+
+# Runs the bitfield pack test again with pdep and pext, on processors with BMI2
+if grep -qw bmi2 /proc/cpuinfo 2> /dev/null; then
+    echo "[ RUN  ] bitfield_pack (bmi2)"
+    $CXX $CXXFLAGS -mbmi2 bitfield_pack.cpp -o "$BUILD/bitfield_pack_bmi2" \
+        || fail "bitfield_pack (bmi2)"
+    "./$BUILD/bitfield_pack_bmi2" || fail "bitfield_pack (bmi2)"
+    echo "[  OK  ] bitfield_pack (bmi2)"
+fi
+
+# Checks that the loop over zipped contiguous ranges is vectorized
+echo "[ RUN  ] codegen/zip_view"
+$CXX $CXXFLAGS -O3 -fopt-info-vec-optimized -c codegen/zip_view.cpp \
+    -o "$BUILD/zip_view.o" 2> "$BUILD/zip_view.log" || fail "codegen/zip_view"
+grep -q "loop vectorized" "$BUILD/zip_view.log" || fail "codegen/zip_view"
+echo "[  OK  ] codegen/zip_view"
+
+# Checks that accesses to aggregates through packs compile as the hand-written
+echo "[ RUN  ] codegen/pack_aggregate"
+$CXX $CXXFLAGS -S codegen/pack_aggregate.cpp -o "$BUILD/pack_aggregate.s" \
+    || fail "codegen/pack_aggregate"
+body "$BUILD/pack_aggregate.s" hand_written > "$BUILD/hand_written.s"
+[ -s "$BUILD/hand_written.s" ] || fail "codegen/pack_aggregate"
+for name in decomposed viewed; do
+    body "$BUILD/pack_aggregate.s" "$name" > "$BUILD/$name.s"
+    cmp -s "$BUILD/hand_written.s" "$BUILD/$name.s" \
+        || fail "codegen/pack_aggregate"
+done
+echo "[  OK  ] codegen/pack_aggregate"
+
+# Compiles the stress test within its budget, in seconds and kilobytes of
+# virtual memory, and runs it: only on demand, with STRESS=1, as it takes
+# minutes and gigabytes to compile
+if [ -n "$STRESS" ]; then
+    echo "[ RUN  ] stress/pack_stress"
+    (
+        ulimit -v "$STRESS_MEMORY"
+        timeout "$STRESS_TIME" $CXX $CXXFLAGS \
+            -DPCK_STRESS_SIZE="$STRESS_SIZE" \
+            stress/pack_stress.cpp -o "$BUILD/pack_stress"
+    ) || fail "stress/pack_stress"
+    "./$BUILD/pack_stress" || fail "stress/pack_stress"
+    echo "[  OK  ] stress/pack_stress"
+fi
+
+# Compiles and runs each benchmark, printing its measurements, and times the
+# compilation of each compile-time benchmark against its baseline, counting
+# the classes they instantiate with g++: only on demand, with BENCH=1, as they
+# take seconds and depend on the machine
+if [ -n "$BENCH" ]; then
+    mkdir -p "$BUILD/bench"
+    for bench in bench/*.cpp; do
+        name="${bench%.cpp}"
+        echo "[ RUN  ] $name"
+        $CXX $CXXFLAGS "$bench" -o "$BUILD/$name" $LDLIBS || fail "$name"
+        "./$BUILD/$name" || fail "$name"
+        echo "[  OK  ] $name"
+    done
+    for bench in bench/compile/*.cpp; do
+        name="${bench%.cpp}"
+        echo "[ RUN  ] $name"
+        library="$(elapsed $CXX $CXXFLAGS -fsyntax-only "$bench")" \
+            || fail "$name"
+        baseline="$(elapsed $CXX $CXXFLAGS -fsyntax-only \
+            -DPCK_BENCH_BASELINE "$bench")" || fail "$name"
+        echo "    library: ${library}ms, baseline: ${baseline}ms"
+        if $CXX --version | grep -q "Free Software Foundation"; then
+            library="$(classes "$bench")" || fail "$name"
+            baseline="$(classes -DPCK_BENCH_BASELINE "$bench")" \
+                || fail "$name"
+            echo "    library: $library classes, baseline: $baseline classes"
+        fi
+        echo "[  OK  ] $name"
+    done
+fi
+# ========================================================================== #
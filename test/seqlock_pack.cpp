@@ -0,0 +1,132 @@
+// =========================== SEQLOCK PACK TEST ============================ //
+// Project:         Pack
+// Name:            seqlock_pack.cpp
+// Description:     Tests of the packs written by one thread and read by many
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ------------------------ SEQLOCK PACK TEST: TYPES ------------------------ //
+// A pack spanning several words, whose size is not a multiple of a word
+using quote = seqlock_pack<double, double, std::uint64_t, std::uint32_t, char>;
+
+// Returns a quote whose elements are all derived from the same number
+quote::value_type make_quote(std::uint32_t number)
+{
+    return quote::value_type(
+        number * .5,
+        number * 2.,
+        std::uint64_t(number) << 32,
+        number,
+        static_cast<char>(number % 128)
+    );
+}
+
+// Returns whether all the elements of a quote derive from the same number
+bool is_consistent(const quote::value_type& value)
+{
+    const quote::value_type expected = make_quote(get<3>(value));
+    return get<0>(value) == get<0>(expected)
+        && get<1>(value) == get<1>(expected)
+        && get<2>(value) == get<2>(expected)
+        && get<4>(value) == get<4>(expected);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- SEQLOCK PACK TEST: OPERATIONS --------------------- //
+// Loads, stores and updates all the elements, apart from other cache lines
+void test_operations()
+{
+    static_assert(quote::size() == 5);
+    static_assert(alignof(quote) >= cache_line_size);
+    quote x;
+    assert(get<0>(x.load()) == 0. && get<3>(x.load()) == 0);
+    x.store(make_quote(7));
+    quote::value_type value(uninitialized);
+    assert(x.try_load(value) && get<3>(value) == 7 && is_consistent(value));
+    x.update([](quote::value_type& current) {
+        current = make_quote(get<3>(current) + 1);
+    });
+    assert(get<3>(x.load()) == 8 && is_consistent(x.load()));
+    const seqlock_pack<int, char> y(object_pack<int, char>(-1, 'a'));
+    assert(get<0>(y.load()) == -1 && get<1>(y.load()) == 'a');
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- SEQLOCK PACK TEST: CONSISTENCY --------------------- //
+// Never lets readers see a partial store, nor an older store than the last
+// one they saw
+void test_consistency()
+{
+    constexpr std::size_t readers = 3;
+    constexpr std::uint32_t stores = 100000;
+    quote x(make_quote(0));
+    std::atomic<bool> done = false;
+    std::atomic<bool> consistent = true;
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < readers; ++i) {
+        threads.emplace_back([&] {
+            std::uint32_t last = 0;
+            while (!done.load()) {
+                const quote::value_type value = x.load();
+                const bool ordered = last <= get<3>(value);
+                consistent = consistent && ordered && is_consistent(value);
+                last = get<3>(value);
+            }
+        });
+    }
+    for (std::uint32_t i = 1; i <= stores; ++i) {
+        if (i % 2 == 0) {
+            x.store(make_quote(i));
+        } else {
+            x.update([](quote::value_type& value) {
+                value = make_quote(get<3>(value) + 1);
+            });
+        }
+        if (i % 1000 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    done = true;
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    assert(consistent.load() && get<3>(x.load()) == stores);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ SEQLOCK PACK TEST: MAIN ------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_operations();
+    test_consistency();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,73 @@
+// =========================== SHARDED PACK TEST ============================ //
+// Project:         Pack
+// Name:            sharded_pack.cpp
+// Description:     Tests of the packs replicated for each thread
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <algorithm>
+#include <functional>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// --------------------- SHARDED PACK TEST: AGGREGATION --------------------- //
+// Folds the replicas with operations whose identity is not zero: the threads
+// are kept alive until all of them have updated, so that each has a replica
+void test_aggregation()
+{
+    sharded_pack<long, double> pack;
+    assert(get<0>(pack.aggregate(std::multiplies<>())) == 0);
+    std::vector<std::thread> threads;
+    std::atomic<int> updated = 0;
+    for (long value = 2; value <= 4; ++value) {
+        threads.emplace_back([&pack, &updated, value] {
+            pack.update([value](auto& replica) {
+                get<0>(replica) = value;
+                get<1>(replica) = 1.5 * value;
+            });
+            ++updated;
+            while (updated.load() != 3) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const auto product = pack.aggregate(std::multiplies<>());
+    assert(get<0>(product) == 24 && get<1>(product) == 81.);
+    const auto minimum = pack.aggregate([](auto lhs, auto rhs) {
+        return std::min(lhs, rhs);
+    });
+    assert(get<0>(minimum) == 2 && get<1>(minimum) == 3.);
+    const auto sum = pack.aggregate();
+    assert(get<0>(sum) == 9 && get<1>(sum) == 13.5);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ SHARDED PACK TEST: MAIN ------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_aggregation();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
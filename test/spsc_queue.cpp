@@ -0,0 +1,127 @@
+// ============================ SPSC QUEUE TEST ============================= //
+// Project:         Pack
+// Name:            spsc_queue.cpp
+// Description:     Tests of the single-producer single-consumer queue
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cassert>
+#include <vector>
+#include <stdexcept>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ------------------------- SPSC QUEUE TEST: TYPES ------------------------- //
+// Counts its live instances
+struct counted
+{
+    explicit counted(int value): value(value) {++instances;}
+    counted(const counted& other): value(other.value) {++instances;}
+    counted(counted&& other): value(other.value) {++instances;}
+    ~counted() {--instances;}
+    int value;
+    inline static int instances = 0;
+};
+
+// Counts its live instances, and throws when moved with a negative value
+struct throwing
+{
+    explicit throwing(int value): value(value) {++instances;}
+    throwing(const throwing& other): value(other.value) {++instances;}
+    throwing(throwing&& other): value(other.value) {
+        if (value < 0) {
+            throw std::runtime_error("move");
+        }
+        ++instances;
+    }
+    ~throwing() {--instances;}
+    int value;
+    inline static int instances = 0;
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- SPSC QUEUE TEST: EXCEPTIONS ----------------------- //
+// Consumes the element whose function throws, and keeps the next ones
+void test_exceptions()
+{
+    {
+        spsc_queue<counted, 8> queue;
+        for (int i = 0; i < 5; ++i) {
+            queue.try_emplace(i);
+        }
+        int sum = 0;
+        bool thrown = false;
+        try {
+            queue.try_pop_n([&sum](counted&& element) {
+                if (element.value == 2) {
+                    throw std::runtime_error("element");
+                }
+                sum += element.value;
+            }, 5);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && sum == 1);
+        assert(counted::instances == 2);
+        const auto count = queue.try_pop_n([&sum](counted&& element) {
+            sum += element.value;
+        }, 5);
+        assert(count == 2 && sum == 8 && queue.empty());
+        assert(counted::instances == 0);
+    }
+    assert(counted::instances == 0);
+}
+
+// Publishes the elements moved before the one whose move throws
+void test_push_exceptions()
+{
+    {
+        std::vector<throwing> elements;
+        elements.reserve(5);
+        for (int value: {0, 1, 2, -1, 4}) {
+            elements.emplace_back(value);
+        }
+        spsc_queue<throwing, 8> queue;
+        bool thrown = false;
+        try {
+            queue.try_push_n(elements.begin(), elements.end());
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && throwing::instances == 8);
+        int sum = 0;
+        const auto count = queue.try_pop_n([&sum](throwing&& element) {
+            sum += element.value;
+        }, 8);
+        assert(count == 3 && sum == 3 && queue.empty());
+        assert(throwing::instances == 5);
+    }
+    assert(throwing::instances == 0);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- SPSC QUEUE TEST: MAIN -------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_exceptions();
+    test_push_exceptions();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
@@ -0,0 +1,115 @@
+// ============================ PACK STRESS TEST ============================ //
+// Project:         Pack
+// Name:            pack_stress.cpp
+// Description:     Instantiation and access of packs of generated elements,
+//                  compiled within a time and memory budget by the runner
+//                  when run with STRESS=1
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+// Project sources
+#include "../../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+#ifndef PCK_STRESS_SIZE
+#define PCK_STRESS_SIZE 16384
+#endif
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ------------------------ PACK STRESS TEST: TYPES ------------------------- //
+// Number of elements of the generated packs: with g++ 12 at -O2, compiling
+// takes 9s and 0.8GB for 4096 elements, 32s and 1.4GB for 8192, and 81s and
+// 2.6GB for 16384, the largest size measured; 65536 elements, extrapolated to
+// over 10GB, have not been measured
+inline constexpr std::size_t stress_size = PCK_STRESS_SIZE;
+
+// A distinct type for each element
+template <std::size_t Index>
+struct field
+{
+    std::size_t value;
+};
+
+// Packs generated from a sequence of indices
+template <class>
+struct generated;
+
+// Packs generated from a sequence of indices: one field per index
+template <std::size_t... Indices>
+struct generated<std::index_sequence<Indices...>>
+{
+    using types = type_pack<field<Indices>...>;
+    using objects = object_pack<field<Indices>...>;
+};
+
+// Packs of the stress size
+using stress = generated<std::make_index_sequence<stress_size>>;
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- PACK STRESS TEST: TYPE PACK ----------------------- //
+// Accesses the first, middle and last types by index and by key
+void test_type_pack()
+{
+    using types = stress::types;
+    constexpr std::size_t middle = stress_size / 2;
+    constexpr std::size_t last = stress_size - 1;
+    static_assert(types::size() == stress_size);
+    static_assert(std::is_same_v<
+        decltype(types{}[pack_index_v<0>])::type,
+        field<0>
+    >);
+    static_assert(std::is_same_v<
+        decltype(types{}[pack_index_v<last>])::type,
+        field<last>
+    >);
+    static_assert(decltype(types{}[field<middle>{}])::index == middle);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- PACK STRESS TEST: OBJECT PACK ---------------------- //
+// Constructs the objects in static storage, to keep them off the stack, and
+// accesses them by index and by key
+void test_object_pack()
+{
+    using objects = stress::objects;
+    constexpr std::size_t middle = stress_size / 2;
+    constexpr std::size_t last = stress_size - 1;
+    static_assert(objects::size() == stress_size);
+    static objects pack;
+    pack[pack_index_v<0>].value().value = 0;
+    pack[field<middle>{}].value().value = middle;
+    get<last>(pack).value = last;
+    assert(pack[pack_index_v<0>].value().value == 0);
+    assert(get<middle>(pack).value == middle);
+    assert(pack[field<last>{}].value().value == last);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- PACK STRESS TEST: MAIN ------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_type_pack();
+    test_object_pack();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
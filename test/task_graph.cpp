@@ -0,0 +1,152 @@
+// ============================ TASK GRAPH TEST ============================= //
+// Project:         Pack
+// Name:            task_graph.cpp
+// Description:     Tests of the concurrent execution of stages
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+#include <string>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ------------------------- TASK GRAPH TEST: TYPES ------------------------- //
+// Stages returning values computed from the results of their dependencies
+struct parse {
+    int operator()() const {return 21;}
+};
+struct load {
+    using depends_on = type_pack<parse>;
+    long operator()(int x) const {return x * 2L;}
+};
+struct render {
+    using depends_on = type_pack<load, parse>;
+    std::string operator()(long x, int y) const {
+        return std::to_string(x + y);
+    }
+};
+
+// Stages returning void, and a stage depending on one of them
+inline std::atomic<int> traces = 0;
+struct trace {
+    void operator()() const {++traces;}
+};
+struct tally {
+    using depends_on = type_pack<trace, parse>;
+    void operator()(task_void_t, int) const {++traces;}
+};
+struct report {
+    using depends_on = type_pack<tally>;
+    int operator()(task_void_t) const {return traces.load();}
+};
+
+// Stages throwing on demand, and a stage depending on one of them
+inline std::atomic<bool> failing = true;
+inline std::atomic<int> reports = 0;
+struct fail {
+    int operator()() const {
+        if (failing.load()) {
+            throw std::runtime_error("fail");
+        }
+        return 1;
+    }
+};
+struct after {
+    using depends_on = type_pack<fail>;
+    int operator()(int x) const {++reports; return x + 1;}
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ TASK GRAPH TEST: RESULTS ------------------------ //
+// Runs stages in an order compatible with their dependencies
+void test_results()
+{
+    using graph = task_graph<type_pack<render, load, parse>>;
+    for (std::size_t threads : {0, 1, 3}) {
+        graph tasks(threads);
+        for (int i = 0; i < 100; ++i) {
+            const auto results = tasks.run();
+            assert(get<0>(results) == "63");
+            assert(get<1>(results) == 42 && get<2>(results) == 21);
+        }
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- TASK GRAPH TEST: VOID STAGES ---------------------- //
+// Replaces the results of void stages by a tag handed to their dependents
+void test_void_stages()
+{
+    using graph = task_graph<type_pack<report, tally, trace, parse>>;
+    static_assert(std::is_same_v<
+        graph::results_type,
+        object_pack<int, task_void_t, task_void_t, int>
+    >);
+    for (std::size_t threads : {0, 3}) {
+        graph tasks(threads);
+        traces = 0;
+        const auto results = tasks.run();
+        assert(get<0>(results) == 2 && get<3>(results) == 21);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- TASK GRAPH TEST: EXCEPTIONS ----------------------- //
+// Rethrows the exceptions of the stages from run, and skips the next stages
+void test_exceptions()
+{
+    using graph = task_graph<type_pack<after, fail, parse>>;
+    for (std::size_t threads : {0, 3}) {
+        graph tasks(threads);
+        for (int i = 0; i < 100; ++i) {
+            bool thrown = false;
+            failing = true;
+            reports = 0;
+            try {
+                tasks.run();
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+            assert(thrown && reports == 0);
+            failing = false;
+            const auto results = tasks.run();
+            assert(get<0>(results) == 2 && reports == 1);
+        }
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- TASK GRAPH TEST: MAIN -------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_results();
+    test_void_stages();
+    test_exceptions();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
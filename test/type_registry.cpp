@@ -0,0 +1,136 @@
+// =========================== TYPE REGISTRY TEST =========================== //
+// Project:         Pack
+// Name:            type_registry.cpp
+// Description:     Tests of the compact ids of the types of a pack
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// ----------------------- TYPE REGISTRY TEST: TYPES ------------------------ //
+// A registry of a few types
+using registry = type_registry<type_pack<char, double, std::string, int*>>;
+
+// Returns a pack of the given number of distinct types
+template <std::size_t... Indices>
+type_pack<std::integral_constant<std::size_t, Indices>...> make_types(
+    std::index_sequence<Indices...>
+);
+template <std::size_t Size>
+using types = decltype(make_types(std::make_index_sequence<Size>{}));
+
+// Returns the size of a type
+struct size_of
+{
+    template <class Type>
+    constexpr std::size_t operator()(type_id<Type>) const noexcept {
+        return sizeof(Type);
+    }
+};
+
+// Records the sizes of the types it is called on
+struct recorder
+{
+    template <class Type>
+    void operator()(type_id<Type>) {
+        sizes.push_back(sizeof(Type));
+    }
+    std::vector<std::size_t> sizes;
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- TYPE REGISTRY TEST: IDS ------------------------ //
+// Identifies the types by their index, in the smallest unsigned integer type
+void test_ids()
+{
+    static_assert(registry::size() == 4);
+    static_assert(registry::id_of<char> == 0 && registry::id_of<int*> == 3);
+    static_assert(std::is_same_v<registry::type_at<2>, std::string>);
+    static_assert(registry::contains<double> && !registry::contains<float>);
+    static_assert(!registry::contains<const double>);
+    static_assert(std::is_same_v<registry::id_type, std::uint8_t>);
+    static_assert(std::is_same_v<
+        decltype(registry::id_of<double>),
+        const std::uint8_t
+    >);
+    using bytes = type_registry<types<256>>;
+    using words = type_registry<types<257>>;
+    static_assert(std::is_same_v<bytes::id_type, std::uint8_t>);
+    static_assert(std::is_same_v<words::id_type, std::uint16_t>);
+    using last = std::integral_constant<std::size_t, 256>;
+    static_assert(words::id_of<last> == 256);
+    static_assert(std::is_same_v<
+        words::type_at<200>,
+        std::integral_constant<std::size_t, 200>
+    >);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- TYPE REGISTRY TEST: VISIT ------------------------ //
+// Calls a function on the type of an id known at run time, forwarding the
+// function, and in constant expressions
+void test_visit()
+{
+    static_assert(registry::visit(0, size_of()) == 1);
+    static_assert(registry::visit(1, size_of()) == sizeof(double));
+    static_assert(registry::visit(3, size_of()) == sizeof(int*));
+    recorder record;
+    const std::vector<registry::id_type> ids = {2, 0, 3, 1};
+    for (registry::id_type id : ids) {
+        registry::visit(id, record);
+    }
+    assert(record.sizes.size() == 4);
+    assert(record.sizes[0] == sizeof(std::string) && record.sizes[1] == 1);
+    assert(record.sizes[2] == sizeof(int*));
+    assert(record.sizes[3] == sizeof(double));
+    std::string name;
+    registry::visit(registry::id_of<std::string>, [&name](auto id) {
+        using type = typename decltype(id)::type;
+        name = std::is_same_v<type, std::string> ? "string" : "other";
+    });
+    assert(name == "string");
+    static std::size_t counts[registry::size()] = {};
+    std::size_t& count = registry::visit(1, [](auto id) -> std::size_t& {
+        using type = typename decltype(id)::type;
+        return counts[registry::id_of<type>];
+    });
+    ++count;
+    assert(counts[1] == 1 && &count == &counts[1]);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ TYPE REGISTRY TEST: MAIN ------------------------ //
+// Runs the tests
+int main(int, char*[])
+{
+    test_ids();
+    test_visit();
+    return 0;
+}
+// -------------------------------------------------------------------------- //
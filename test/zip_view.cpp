@@ -0,0 +1,96 @@
+// ============================= ZIP VIEW TEST ============================== //
+// Project:         Pack
+// Name:            zip_view.cpp
+// Description:     Tests of the iteration over several ranges in lockstep
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <numeric>
+// Project sources
+#include "../include/pack.hpp"
+// Third-party libraries
+// Miscellaneous
+using namespace pck;
+// ========================================================================== //
+
+
+
+// -------------------------- ZIP VIEW TEST: TYPES -------------------------- //
+// A contiguous window over the elements of another range
+struct window
+{
+    int* data() const {return first;}
+    int* begin() const {return first;}
+    int* end() const {return first + size;}
+    int* first;
+    std::size_t size;
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ ZIP VIEW TEST: ITERATORS ------------------------ //
+// Offsets iterators from either side
+void test_iterators()
+{
+    std::vector<int> x = {0, 1, 2, 3};
+    std::vector<double> y = {4., 5., 6., 7.};
+    auto view = zip(x, y);
+    auto first = view.begin();
+    assert(2 + first == first + 2 && 2 + first - 2 == first);
+    assert(get<0>(*(3 + first)) == 3 && get<1>(*(1 + first)) == 5.);
+    assert(view.end() - (4 + first) == 0);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- ZIP VIEW TEST: OVERLAP ------------------------- //
+// Loops over overlapping ranges as if one row were processed after the other
+void test_overlap()
+{
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    window lower{values.data(), values.size() - 1};
+    window upper{values.data() + 1, values.size() - 1};
+    zip(lower, upper).for_each([](auto row) {
+        get<1>(row) = get<0>(row) + 1;
+    });
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(values[i] == static_cast<int>(i));
+    }
+    zip(lower, upper).for_each([](auto row) {
+        get<1>(row) += get<0>(row);
+    });
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(values[i] == static_cast<int>(i * (i + 1) / 2));
+    }
+    std::vector<int> copy(values.size());
+    zip(values, values, copy).for_each([](auto row) {
+        get<2>(row) = get<0>(row) + get<1>(row);
+        get<0>(row) = 0;
+    });
+    assert(copy.back() == 999 * 1000 && values.back() == 0);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- ZIP VIEW TEST: MAIN --------------------------- //
+// Runs the tests
+int main(int, char*[])
+{
+    test_iterators();
+    test_overlap();
+    return 0;
+}
+// -------------------------------------------------------------------------- //